@@ -0,0 +1,34 @@
+/////////////////////////////////////////////////////////////////////
+//
+//	Arduino RealTimeClock
+//
+//	OLED display interface selection
+//
+//	Default build: SSD1306 on the I2C bus shared with the DS3231 clock.
+//	Define OLED_SPI (see platformio.ini) for a display module wired to
+//	the hardware SPI pins: MOSI D11, SCK D13 and the pins below.
+//
+/////////////////////////////////////////////////////////////////////
+
+#ifndef _DISPLAY_CONFIG_H_
+#define _DISPLAY_CONFIG_H_
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+
+#ifdef OLED_SPI
+#define OLED_DC 6        // data/command is connected to Arduino pin D6
+#define OLED_CS 10       // chip select is connected to Arduino pin D10
+#define OLED_RESET 5     // display reset is connected to Arduino pin D5
+#define OLED_SPI_CLOCK 8000000UL // fosc/2 on a 16MHz Nano
+
+// Adafruit_SSD1306_Fixed constructor arguments
+#define OLED_DISPLAY_ARGS &SPI, OLED_DC, OLED_RESET, OLED_CS, OLED_SPI_CLOCK
+#else
+#define OLED_RESET -1    // reset is shared with the Arduino
+
+// Adafruit_SSD1306_Fixed constructor arguments
+#define OLED_DISPLAY_ARGS &Wire, OLED_RESET
+#endif
+
+#endif
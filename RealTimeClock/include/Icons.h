@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////
+//
+//	Arduino RealTimeClock
+//
+//	Clock screen decorations
+//
+//	Icons are stored in SSD1306 page format: one byte per column for
+//	each 8-pixel page, least significant bit on top. Draw them with
+//	display.drawPageBitmap(); at a y that is a multiple of 8 and white
+//	on black they are copied straight from flash.
+//
+/////////////////////////////////////////////////////////////////////
+
+#ifndef _ICONS_H_
+#define _ICONS_H_
+
+// degree symbol followed by a size 2 C or F
+// same pixels as drawCircle(110, 51, 3) and text size 2 at (116, 48)
+#define ICON_DEGREE_X 107
+#define ICON_DEGREE_Y 48
+#define ICON_DEGREE_WIDTH 19
+#define ICON_DEGREE_HEIGHT 16
+
+const PROGMEM byte iconDegreeC[] =
+  {
+    0x1C, 0x22, 0x41, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0xFC,
+    0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0C, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C
+  };
+
+const PROGMEM byte iconDegreeF[] =
+  {
+    0x1C, 0x22, 0x41, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0xFF,
+    0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+
+// 8 by 8 status markers
+#define ICON_SMALL_WIDTH 8
+#define ICON_SMALL_HEIGHT 8
+
+// alarm is set
+const PROGMEM byte iconBell[] =
+  {
+    0x20, 0x3C, 0x3E, 0xBF, 0xBF, 0x3E, 0x3C, 0x20
+  };
+
+// daylight saving adjustment is pending
+const PROGMEM byte iconDaylight[] =
+  {
+    0x49, 0x22, 0x1C, 0x5D, 0x1C, 0x22, 0x49, 0x00
+  };
+
+// temperature probe is missing or does not answer
+// drawn on the last page, bottom row (bit 7) is left blank
+// so the pixel shift never wraps it to the top of the screen
+const PROGMEM byte iconProbeMissing[] =
+  {
+    0x7F, 0x63, 0x55, 0x49, 0x55, 0x63, 0x7F, 0x00
+  };
+
+#endif
@@ -700,6 +700,81 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   endWrite();
 }
 
+// Seven-segment patterns for 0-9 and '-', bit 0 = segment a ... bit 6 = g
+static const uint8_t PROGMEM sevenSegments[] = {0x3F, 0x06, 0x5B, 0x4F,
+                                                0x66, 0x6D, 0x7D, 0x07,
+                                                0x7F, 0x6F, 0x40};
+
+// Fill one segment bar, optionally with pointed (beveled) ends
+static void sevenSegmentBar(Adafruit_GFX *gfx, int16_t x, int16_t y,
+                            int16_t w, int16_t h, bool horizontal, bool bevel,
+                            uint16_t color) {
+  if ((w <= 0) || (h <= 0))
+    return;
+  if (!bevel) {
+    gfx->fillRect(x, y, w, h, color);
+  } else if (horizontal) { // Horizontal bar, points left and right
+    int16_t b = h / 2, c = y + (h - 1) / 2;
+    gfx->fillRect(x + b, y, w - 2 * b, h, color);
+    gfx->fillTriangle(x, c, x + b, y, x + b, y + h - 1, color);
+    gfx->fillTriangle(x + w - 1, c, x + w - 1 - b, y, x + w - 1 - b,
+                      y + h - 1, color);
+  } else { // Vertical bar, points up and down
+    int16_t b = w / 2, c = x + (w - 1) / 2;
+    gfx->fillRect(x, y + b, w, h - 2 * b, color);
+    gfx->fillTriangle(c, y, x, y + b, x + w - 1, y + b, color);
+    gfx->fillTriangle(c, y + h - 1, x, y + h - 1 - b, x + w - 1,
+                      y + h - 1 - b, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw a seven-segment style digit from filled bars. Only set
+   segments are drawn, clear the digit's box first when overwriting.
+   On page-organized displays (SSD1306) keep y, t and h multiples of 8
+   so the top and bottom bars fill whole buffer bytes. The middle bar
+   sits at (h - t) / 2 and is page-aligned only when h - t is a multiple
+   of 16 as well (e.g. h = 56, t = 8; not h = 64, t = 8).
+    @param    x      Left edge of the digit box
+    @param    y      Top edge of the digit box
+    @param    digit  0-9, 10 for '-', anything else draws nothing
+    @param    w      Digit box width (should be > 2 * t)
+    @param    h      Digit box height (should be > 3 * t)
+    @param    t      Segment thickness
+    @param    color  16-bit 5-6-5 Color to fill with
+    @param    bevel  true for pointed segment ends (uses fillTriangle)
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawSevenSegment(int16_t x, int16_t y, uint8_t digit,
+                                    int16_t w, int16_t h, int16_t t,
+                                    uint16_t color, bool bevel) {
+  if (digit >= sizeof(sevenSegments))
+    return;
+  uint8_t segs = pgm_read_byte(&sevenSegments[digit]);
+  int16_t m = (h - t) / 2;        // Middle bar offset from top
+  int16_t hl = m - t;             // Upper vertical bar length
+  int16_t hr = h - m - 2 * t;     // Lower vertical bar length
+  int16_t xr = x + w - t, wm = w - 2 * t;
+
+  startWrite();
+  if (segs & 0x01) // a
+    sevenSegmentBar(this, x + t, y, wm, t, true, bevel, color);
+  if (segs & 0x02) // b
+    sevenSegmentBar(this, xr, y + t, t, hl, false, bevel, color);
+  if (segs & 0x04) // c
+    sevenSegmentBar(this, xr, y + m + t, t, hr, false, bevel, color);
+  if (segs & 0x08) // d
+    sevenSegmentBar(this, x + t, y + h - t, wm, t, true, bevel, color);
+  if (segs & 0x10) // e
+    sevenSegmentBar(this, x, y + m + t, t, hr, false, bevel, color);
+  if (segs & 0x20) // f
+    sevenSegmentBar(this, x, y + t, t, hl, false, bevel, color);
+  if (segs & 0x40) // g
+    sevenSegmentBar(this, x + t, y + m, wm, t, true, bevel, color);
+  endWrite();
+}
+
 // BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
 /**************************************************************************/
@@ -1099,6 +1174,22 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
 
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
+// Locate a character in the classic font
+/**************************************************************************/
+/*!
+   @brief   Find the column bitmap of a character in the 'classic' built-in
+   font, applying the CP437 index correction. For subclasses that render the
+   classic font directly into their own buffer.
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @returns  PROGMEM pointer to the character's 5 column bytes, bit 0 on top
+*/
+/**************************************************************************/
+const uint8_t *Adafruit_GFX::classicGlyph(unsigned char c) const {
+  if (!_cp437 && (c >= 176))
+    c++; // Handle 'classic' charset behavior
+  return &font[c * 5];
+}
+
 // Draw a character
 /**************************************************************************/
 /*!
@@ -1135,20 +1226,45 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
                             uint16_t color, uint16_t bg, uint8_t size_x,
                             uint8_t size_y) {
 
-  if (!gfxFont) { // 'Classic' built-in font
+  if (!gfxFont && ((x >= _width) ||              // Clip right
+                   (y >= _height) ||             // Clip bottom
+                   ((x + 6 * size_x - 1) < 0) || // Clip left
+                   ((y + 8 * size_y - 1) < 0)))  // Clip top
+    return;
 
-    if ((x >= _width) ||              // Clip right
-        (y >= _height) ||             // Clip bottom
-        ((x + 6 * size_x - 1) < 0) || // Clip left
-        ((y + 8 * size_y - 1) < 0))   // Clip top
-      return;
+  startWrite();
+  writeChar(x, y, c, color, bg, size_x, size_y);
+  endWrite();
+}
+
+// Write a character
+/**************************************************************************/
+/*!
+   @brief   Write a single character, no clipping and no transaction of its
+   own: the caller clips whole characters and wraps startWrite()/endWrite()
+   around one or more calls. Pixels outside the display are still dropped by
+   writePixel() and friends. Subclasses may override this with a faster
+   renderer for their own buffer layout.
+    @param    x   Bottom left corner x coordinate
+    @param    y   Bottom left corner y coordinate
+    @param    c   The 8-bit font-indexed character (likely ascii)
+    @param    color 16-bit 5-6-5 Color to draw chraracter with
+    @param    bg 16-bit 5-6-5 Color to fill background with (if same as color,
+   no background)
+    @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeChar(int16_t x, int16_t y, unsigned char c,
+                             uint16_t color, uint16_t bg, uint8_t size_x,
+                             uint8_t size_y) {
 
-    if (!_cp437 && (c >= 176))
-      c++; // Handle 'classic' charset behavior
+  if (!gfxFont) { // 'Classic' built-in font
+
+    const uint8_t *glyph = classicGlyph(c);
 
-    startWrite();
     for (int8_t i = 0; i < 5; i++) { // Char bitmap = 5 columns
-      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+      uint8_t line = pgm_read_byte(&glyph[i]);
       for (int8_t j = 0; j < 8; j++, line >>= 1) {
         if (line & 1) {
           if (size_x == 1 && size_y == 1)
@@ -1170,7 +1286,6 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
       else
         writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
     }
-    endWrite();
 
   } else { // Custom font
 
@@ -1212,7 +1327,49 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
-    startWrite();
+    if (pgm_read_byte(&gfxFont->encoding) == GFXFONT_RLE) {
+      // Stream runs straight into horizontal spans, splitting at row ends
+      uint16_t left = (uint16_t)w * h, run = 0;
+      bool set = false;
+      xx = yy = 0;
+      while (left) {
+        uint8_t n;
+        if (!(bit++ & 1)) {
+          bits = pgm_read_byte(&bitmap[bo++]);
+          n = bits >> 4;
+        } else {
+          n = bits & 0x0F;
+        }
+        run += n;
+        if (n == 15)
+          continue; // Run goes on in the next nibble
+        if (run > left)
+          run = left; // Malformed data, don't draw outside the glyph
+        left -= run;
+        while (run) {
+          uint8_t span = w - xx;
+          if (span > run)
+            span = run;
+          if (set) {
+            if (size_x == 1 && size_y == 1) {
+              writeFastHLine(x + xo + xx, y + yo + yy, span, color);
+            } else {
+              writeFillRect(x + (xo16 + xx) * size_x,
+                            y + (yo16 + yy) * size_y, span * size_x, size_y,
+                            color);
+            }
+          }
+          xx += span;
+          run -= span;
+          if (xx == w) {
+            xx = 0;
+            yy++;
+          }
+        }
+        set = !set;
+      }
+      return;
+    }
     for (yy = 0; yy < h; yy++) {
       for (xx = 0; xx < w; xx++) {
         if (!(bit++ & 7)) {
@@ -1229,7 +1386,6 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         bits <<= 1;
       }
     }
-    endWrite();
 
   } // End classic vs custom font
 }
@@ -1285,6 +1441,98 @@ size_t Adafruit_GFX::write(uint8_t c) {
   return 1;
 }
 
+/**************************************************************************/
+/*!
+    @brief  Draw a run of characters on one line inside a single write
+   transaction. For the classic font the run is clipped vertically once;
+   characters are then only tested against the left and right edges, and
+   drawing stops at the right edge. No wrapping, newlines are not special.
+    @param  x        Cursor x coordinate of the first character
+    @param  y        Cursor y coordinate of the first character
+    @param  str      String in RAM or PROGMEM
+    @param  len      Maximum number of characters, stops early at a null
+    @param  size_x   Font magnification level in X-axis
+    @param  size_y   Font magnification level in Y-axis
+    @param  color    16-bit 5-6-5 Color to draw text with
+    @param  bg       16-bit 5-6-5 Color to fill background with (if same as
+   color, no background)
+    @param  progmem  true if str is in PROGMEM
+    @returns  Cursor x coordinate following the last character drawn
+*/
+/**************************************************************************/
+int16_t Adafruit_GFX::drawRun(int16_t x, int16_t y, const char *str,
+                              uint16_t len, uint8_t size_x, uint8_t size_y,
+                              uint16_t color, uint16_t bg, bool progmem) {
+  uint8_t first = 0, last = 0;
+  int16_t cw = 6 * size_x;
+  if (!gfxFont) {
+    if ((y >= _height) || ((y + 8 * size_y - 1) < 0))
+      return x; // Whole run is above or below the display
+  } else {
+    first = pgm_read_byte(&gfxFont->first);
+    last = pgm_read_byte(&gfxFont->last);
+  }
+
+  startWrite();
+  while (len-- && (x < _width)) {
+    uint8_t c = progmem ? pgm_read_byte(str++) : *str++;
+    if (!c)
+      break;
+    if (!gfxFont) {
+      if (x + cw > 0) // Left edge
+        writeChar(x, y, c, color, bg, size_x, size_y);
+      x += cw;
+    } else if ((c >= first) && (c <= last)) {
+      GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+      int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+      if (x + (xo + pgm_read_byte(&glyph->width)) * size_x > 0)
+        writeChar(x, y, c, color, bg, size_x, size_y);
+      x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)size_x;
+    }
+  }
+  endWrite();
+  return x;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw up to len characters of a string on one line with one clip
+   test and one write transaction for the whole run. Does not use or move
+   the text cursor, and does not wrap.
+    @param  x      Cursor x coordinate of the first character
+    @param  y      Cursor y coordinate of the first character
+    @param  str    String, may be shorter than len if null-terminated
+    @param  len    Maximum number of characters to draw
+    @param  size   Font magnification level, 1 is 'original' size
+    @param  color  16-bit 5-6-5 Color to draw text with
+    @param  bg     16-bit 5-6-5 Color to fill background with (if same as
+   color, no background)
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawString(int16_t x, int16_t y, const char *str,
+                              uint16_t len, uint8_t size, uint16_t color,
+                              uint16_t bg) {
+  drawRun(x, y, str, len, size, size, color, bg, false);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a string stored in program memory on one line starting at
+   (x,y), with the current text size, colors and font, in one write
+   transaction (see drawString()). Characters are read from flash one at a
+   time, no RAM copy of the string is made. No wrapping; leaves the cursor
+   after the last character drawn.
+    @param  x    Cursor x coordinate of the first character
+    @param  y    Cursor y coordinate of the first character
+    @param  str  Null-terminated PROGMEM string
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawStringP(int16_t x, int16_t y, const char *str) {
+  cursor_x = drawRun(x, y, str, 0xFFFF, textsize_x, textsize_y, textcolor,
+                     textbgcolor, true);
+  cursor_y = y;
+}
+
 /**************************************************************************/
 /*!
     @brief   Set text 'magnification' size. Each increase in s makes 1 pixel
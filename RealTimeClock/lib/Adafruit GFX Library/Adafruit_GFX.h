@@ -74,6 +74,9 @@ public:
                     int16_t y2, uint16_t color);
   void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
                     int16_t y2, uint16_t color);
+  void drawSevenSegment(int16_t x, int16_t y, uint8_t digit, int16_t w,
+                        int16_t h, int16_t t, uint16_t color,
+                        bool bevel = false);
   void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                      int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
@@ -108,6 +111,11 @@ public:
                 uint16_t bg, uint8_t size);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
                 uint16_t bg, uint8_t size_x, uint8_t size_y);
+  virtual void writeChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                         uint16_t bg, uint8_t size_x, uint8_t size_y);
+  void drawString(int16_t x, int16_t y, const char *str, uint16_t len,
+                  uint8_t size, uint16_t color, uint16_t bg);
+  void drawStringP(int16_t x, int16_t y, const char *str);
   void getTextBounds(const char *string, int16_t x, int16_t y, int16_t *x1,
                      int16_t *y1, uint16_t *w, uint16_t *h);
   void getTextBounds(const __FlashStringHelper *s, int16_t x, int16_t y,
@@ -226,9 +234,30 @@ public:
   /************************************************************************/
   int16_t getCursorY(void) const { return cursor_y; };
 
+  /************************************************************************/
+  /*!
+    @brief      Get text color set by setTextColor()
+    @returns    16-bit 5-6-5 Color
+  */
+  /************************************************************************/
+  uint16_t getTextColor(void) const { return textcolor; }
+
+  /************************************************************************/
+  /*!
+    @brief      Get text background color set by setTextColor(); equal to
+                getTextColor() when the background is transparent
+    @returns    16-bit 5-6-5 Color
+  */
+  /************************************************************************/
+  uint16_t getTextBgColor(void) const { return textbgcolor; }
+
 protected:
   void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
                   int16_t *miny, int16_t *maxx, int16_t *maxy);
+  const uint8_t *classicGlyph(unsigned char c) const;
+  int16_t drawRun(int16_t x, int16_t y, const char *str, uint16_t len,
+                  uint8_t size_x, uint8_t size_y, uint16_t color, uint16_t bg,
+                  bool progmem);
   int16_t WIDTH;        ///< This is the 'raw' display width - never changes
   int16_t HEIGHT;       ///< This is the 'raw' display height - never changes
   int16_t _width;       ///< Display width as modified by current rotation
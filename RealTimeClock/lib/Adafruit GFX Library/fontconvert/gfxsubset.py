@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Cut an Adafruit_GFX font header down to the characters a sketch uses.
+
+The character set is given with --chars, or collected from the string and
+character literals of the sources given with --scan (or both). The output
+font covers only the range from the lowest to the highest of these
+characters. Characters inside that range that are not needed keep an empty
+glyph entry, because GFXfont looks glyphs up by 'c - first'. They have no
+bitmap and zero advance.
+
+Characters the sketch builds at run time (e.g. digits computed as
+'0' + n) do not appear as literals; add them with --chars.
+
+The output uses the packed bitmap format by default, or the GFXFONT_RLE
+format with --rle (see rlefont.py).
+
+usage: gfxsubset.py Fonts/FreeSansBold18pt7b.h --chars "0123456789:" --rle
+       gfxsubset.py Fonts/FreeSans12pt7b.h --scan ../../../src/main.cpp
+"""
+
+import argparse
+import re
+import sys
+
+from rlefont import font_header, glyph_pixels, parse_font, rle_encode
+
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '0': '\0', '\\': '\\',
+           "'": "'", '"': '"'}
+
+
+def scan_literals(text):
+    """Return the set of characters in C string and character literals."""
+    text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'^\s*#\s*include[^\n]*', '', text, flags=re.M)
+    chars = set()
+    for m in re.finditer(r'"((?:\\.|[^"\\\n])*)"|\'((?:\\.|[^\'\\\n])+)\'',
+                         text):
+        literal = m.group(1) if m.group(1) is not None else m.group(2)
+        literal = re.sub(r'\\(.)', lambda e: ESCAPES.get(e.group(1), ''),
+                         literal)
+        chars.update(literal)
+    return chars
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('input', help='GFXfont header to subset')
+    parser.add_argument('-c', '--chars', default='',
+                        help='characters to keep')
+    parser.add_argument('-s', '--scan', nargs='*', default=[],
+                        help='sources whose literals give characters to keep')
+    parser.add_argument('--rle', action='store_true',
+                        help='write GFXFONT_RLE glyph data')
+    parser.add_argument('-o', '--output', help='output header (default stdout)')
+    parser.add_argument('-n', '--name',
+                        help='font name in the output (default <input>Sub)')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        name, bitmap, glyphs, first, last, y_advance = parse_font(f.read())
+
+    chars = set(args.chars)
+    for path in args.scan:
+        with open(path) as f:
+            chars |= scan_literals(f.read())
+    codes = sorted(ord(c) for c in chars if first <= ord(c) <= last)
+    if not codes:
+        sys.exit('no characters of the font selected')
+    missing = sorted(c for c in chars
+                     if not first <= ord(c) <= last and c.isprintable())
+    if missing:
+        sys.stderr.write('not in font: %r\n' % ''.join(missing))
+
+    keep = set(codes)
+    data = []
+    new_glyphs = []
+    for code in range(codes[0], codes[-1] + 1):
+        offset, width, height, x_advance, x_off, y_off = glyphs[code - first]
+        if code not in keep:
+            new_glyphs.append((len(data), 0, 0, 0, 0, 0))
+            continue
+        new_glyphs.append((len(data), width, height, x_advance, x_off, y_off))
+        if args.rle:
+            data += rle_encode(glyph_pixels(bitmap, offset, width, height))
+        else:
+            data += bitmap[offset:offset + (width * height + 7) // 8]
+
+    out_name = args.name or name + 'Sub'
+    text, size = font_header(out_name, data, new_glyphs, codes[0], y_advance,
+                             args.rle)
+    header = '// %s: subset of %s, characters %r\n\n' % (
+        out_name, name, ''.join(chr(c) for c in codes))
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header + text)
+    else:
+        sys.stdout.write(header + text)
+    orig = len(bitmap) + 7 * len(glyphs) + 7
+    sys.stderr.write('%s: %d characters, %d bytes -> %d bytes\n' %
+                     (out_name, len(codes), orig, size))
+
+
+if __name__ == '__main__':
+    main()
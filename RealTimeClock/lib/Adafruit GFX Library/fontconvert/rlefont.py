@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Convert an Adafruit_GFX font header to the run-length encoded format.
+
+Reads a GFXfont header as produced by fontconvert (e.g. Fonts/FreeSans24pt7b.h)
+and writes the same font with GFXFONT_RLE glyph data:
+
+    each glyph is scanned row by row, left to right, as one stream of pixels
+    the stream is stored as run lengths of alternately clear and set pixels,
+    starting with clear, one run per 4-bit nibble (high nibble first)
+    nibble 0-14: run length; nibble 15: add 15 and continue the same run
+
+Glyph metrics are unchanged, so getTextBounds() and cursor advance behave
+exactly as with the bitmap version.
+
+usage: rlefont.py Fonts/FreeSans24pt7b.h -o FreeSans24pt7bRLE.h
+"""
+
+import argparse
+import re
+import sys
+
+
+def parse_font(text):
+    """Return (name, bitmap bytes, glyph list, first, last, yAdvance)."""
+    text = re.sub(r'//[^\n]*', '', text)
+    m = re.search(r'const\s+uint8_t\s+(\w+)Bitmaps\[\]\s*PROGMEM\s*=\s*{(.*?)};',
+                  text, re.S)
+    if not m:
+        sys.exit('no Bitmaps[] array found')
+    name = m.group(1)
+    bitmap = [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', m.group(2))]
+
+    m = re.search(r'const\s+GFXglyph\s+\w+Glyphs\[\]\s*PROGMEM\s*=\s*{(.*?)};',
+                  text, re.S)
+    if not m:
+        sys.exit('no Glyphs[] array found')
+    glyphs = [tuple(int(v) for v in g.split(','))
+              for g in re.findall(r'{\s*([-\d\s,]+?)\s*}', m.group(1))]
+
+    m = re.search(r'const\s+GFXfont\s+\w+\s*PROGMEM\s*=\s*{(.*?)};', text, re.S)
+    if not m:
+        sys.exit('no GFXfont found')
+    fields = [f.strip() for f in m.group(1).split(',')]
+    first, last, y_advance = (int(f, 0) for f in fields[2:5])
+    return name, bitmap, glyphs, first, last, y_advance
+
+
+def glyph_pixels(bitmap, offset, width, height):
+    """Unpack a glyph's bits (MSB first, rows not padded) into a list."""
+    pixels = []
+    for i in range(width * height):
+        byte = bitmap[offset + i // 8]
+        pixels.append((byte >> (7 - i % 8)) & 1)
+    return pixels
+
+
+def rle_encode(pixels):
+    """Encode a pixel stream as nibble run lengths, packed two per byte."""
+    nibbles = []
+    value = 0
+    run = 0
+    for pixel in pixels + [None]:
+        if pixel == value:
+            run += 1
+            continue
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+        value = 1 - value
+        run = 1
+    if not pixels:
+        return []
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def font_header(out_name, data, glyphs, first, y_advance, rle):
+    """Format bitmap data and glyph table as a GFXfont header."""
+    if len(data) > 0xFFFF:
+        sys.exit('encoded bitmap exceeds 64K')
+    lines = ['const uint8_t %sBitmaps[] PROGMEM = {' % out_name]
+    for i in range(0, len(data), 12):
+        row = ', '.join('0x%02X' % b for b in data[i:i + 12])
+        lines.append('    %s%s' % (row, ',' if i + 12 < len(data) else '};'))
+    if not data:
+        lines[-1] += '0x00};'
+    lines.append('')
+    lines.append('const GFXglyph %sGlyphs[] PROGMEM = {' % out_name)
+    for i, g in enumerate(glyphs):
+        code = first + i
+        char = chr(code) if 0x20 < code < 0x7F else ' '
+        entry = '{%d, %d, %d, %d, %d, %d}' % g
+        sep = ',' if i + 1 < len(glyphs) else '};'
+        lines.append('    %-28s // 0x%02X %r' % (entry + sep, code, char))
+    lines.append('')
+    lines.append('const GFXfont %s PROGMEM = {(uint8_t *)%sBitmaps,' %
+                 (out_name, out_name))
+    lines.append('    (GFXglyph *)%sGlyphs, 0x%02X, 0x%02X, %d, %s};' %
+                 (out_name, first, first + len(glyphs) - 1, y_advance,
+                  'GFXFONT_RLE' if rle else 'GFXFONT_BITMAP'))
+    lines.append('')
+    size = len(data) + 7 * len(glyphs) + 8
+    lines.append('// Approx. %d bytes%s' % (size, ' (RLE)' if rle else ''))
+    return '\n'.join(lines) + '\n', size
+
+
+def convert(name, bitmap, glyphs, first, last, y_advance, out_name):
+    """Return (header text, encoded size, original size)."""
+    data = []
+    new_glyphs = []
+    for offset, width, height, x_advance, x_off, y_off in glyphs:
+        new_glyphs.append((len(data), width, height, x_advance, x_off, y_off))
+        data += rle_encode(glyph_pixels(bitmap, offset, width, height))
+    text, size = font_header(out_name, data, new_glyphs, first, y_advance,
+                             True)
+    orig = len(bitmap) + 7 * len(glyphs) + 7
+    return text, size, orig
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('input', help='GFXfont header to convert')
+    parser.add_argument('-o', '--output', help='output header (default stdout)')
+    parser.add_argument('-n', '--name',
+                        help='font name in the output (default <input>RLE)')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        name, bitmap, glyphs, first, last, y_advance = parse_font(f.read())
+    if len(glyphs) != last - first + 1:
+        sys.exit('glyph count does not match first/last')
+
+    out_name = args.name or name + 'RLE'
+    text, size, orig = convert(name, bitmap, glyphs, first, last, y_advance,
+                               out_name)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write('%s: %d bytes -> %d bytes\n' % (out_name, orig, size))
+    if size >= orig:
+        sys.stderr.write('warning: RLE is not smaller, keep the bitmap font\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -17,6 +17,14 @@ typedef struct {
   int8_t yOffset;        ///< Y dist from cursor pos to UL corner
 } GFXglyph;
 
+#define GFXFONT_BITMAP 0 ///< Glyphs are packed 1-bit bitmaps (default)
+#define GFXFONT_RLE 1    ///< Glyphs are nibble run lengths, see below
+
+// GFXFONT_RLE glyph data: the glyph's pixels, row by row, are stored as run
+// lengths of alternately clear and set pixels (starting with clear), one
+// run per 4-bit nibble, high nibble first. A nibble of 15 adds 15 pixels
+// and continues the same run. Made by fontconvert/rlefont.py.
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   uint8_t *bitmap;  ///< Glyph bitmaps, concatenated
@@ -24,6 +32,7 @@ typedef struct {
   uint16_t first;   ///< ASCII extents (first char)
   uint16_t last;    ///< ASCII extents (last char)
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t encoding; ///< GFXFONT_BITMAP (omitted in older fonts) or GFXFONT_RLE
 } GFXfont;
 
 #endif // _GFXFONT_H_
@@ -43,6 +43,7 @@
 #else
 #define pgm_read_byte(addr)                                                    \
   (*(const unsigned char *)(addr)) ///< PROGMEM workaround for non-AVR
+#define memcpy_P memcpy ///< PROGMEM workaround for non-AVR
 #endif
 
 #if !defined(__ARM_ARCH) && !defined(ENERGIA) && !defined(ESP8266) &&          \
@@ -52,6 +53,9 @@
 
 #include "Adafruit_SSD1306.h"
 #include "splash.h"
+#ifndef SSD1306_NO_SPRITES
+#include "sprites.h"
+#endif
 #include <Adafruit_GFX.h>
 
 // SOME DEFINES AND STATIC VARIABLES USED INTERNALLY -----------------------
@@ -67,6 +71,12 @@
 #define ssd1306_swap(a, b)                                                     \
   (((a) ^= (b)), ((b) ^= (a)), ((a) ^= (b))) ///< No-temp-var swap operation
 
+#ifdef SSD1306_STATS
+#define STATS_COUNT(n) bytesSent += (n) ///< Count bytes sent to display
+#else
+#define STATS_COUNT(n) ///< Transfer statistics not compiled in
+#endif
+
 #if ARDUINO >= 100
 #define WIRE_WRITE wire->write ///< Wire write function in recent Arduino lib
 #else
@@ -362,6 +372,30 @@ inline void Adafruit_SSD1306::SPIwrite(uint8_t d) {
   }
 }
 
+// Issue a block of bytes out SPI (count > 0). On AVR hardware SPI the data
+// register is loaded directly: the next byte is fetched while the current
+// one shifts out, so at fosc/2 the bus never waits on the loop. Other
+// targets fall back to SPIwrite(). Transaction/selection as for SPIwrite().
+void Adafruit_SSD1306::SPIwriteBlock(const uint8_t *ptr, uint16_t count) {
+#if defined(__AVR__) && defined(SPDR)
+  if (spi) {
+    SPDR = *ptr++;
+    while (--count) {
+      uint8_t d = *ptr++;
+      while (!(SPSR & _BV(SPIF)))
+        ;
+      SPDR = d;
+    }
+    while (!(SPSR & _BV(SPIF)))
+      ;
+    (void)SPDR; // Clear SPIF
+    return;
+  }
+#endif
+  while (count--)
+    SPIwrite(*ptr++);
+}
+
 // Issue single command to SSD1306, using I2C or hard/soft SPI as needed.
 // Because command calls are often grouped, SPI transaction and selection
 // must be started/ended in calling function for efficiency.
@@ -372,24 +406,29 @@ void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
     WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
     WIRE_WRITE(c);
     wire->endTransmission();
+    STATS_COUNT(3);
   } else { // SPI (hw or soft) -- transaction started in calling function
     SSD1306_MODE_COMMAND
     SPIwrite(c);
+    STATS_COUNT(1);
   }
 }
 
 // Issue list of commands to SSD1306, same rules as above re: transactions.
 // This is a private function, not exposed.
 void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
+  STATS_COUNT(n);
   if (wire) { // I2C
     wire->beginTransmission(i2caddr);
     WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+    STATS_COUNT(2);
     uint8_t bytesOut = 1;
     while (n--) {
       if (bytesOut >= WIRE_MAX) {
         wire->endTransmission();
         wire->beginTransmission(i2caddr);
         WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+        STATS_COUNT(2);
         bytesOut = 1;
       }
       WIRE_WRITE(pgm_read_byte(c++));
@@ -403,6 +442,26 @@ void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
   }
 }
 
+// Issue a short list of commands held in RAM (e.g. with computed
+// arguments), same rules as above re: transactions. On I2C the whole list
+// goes out in one transfer, so it must fit in WIRE_MAX - 1 bytes.
+// This is a private function, not exposed.
+void Adafruit_SSD1306::ssd1306_commandBuffer(const uint8_t *c, uint8_t n) {
+  STATS_COUNT(n);
+  if (wire) { // I2C
+    wire->beginTransmission(i2caddr);
+    WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+    STATS_COUNT(2);
+    while (n--)
+      WIRE_WRITE(*c++);
+    wire->endTransmission();
+  } else { // SPI -- transaction started in calling function
+    SSD1306_MODE_COMMAND
+    while (n--)
+      SPIwrite(*c++);
+  }
+}
+
 // A public version of ssd1306_command1(), for existing user code that
 // might rely on that function. This encapsulates the command transfer
 // in a transaction start/end, similar to old library's handling of it.
@@ -464,11 +523,11 @@ bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset,
 
   clearDisplay();
   if (HEIGHT > 32) {
-    drawBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
-               splash1_data, splash1_width, splash1_height, 1);
+    drawPageBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
+                   splash1_data, splash1_width, splash1_height, 1);
   } else {
-    drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
-               splash2_data, splash2_width, splash2_height, 1);
+    drawPageBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
+                   splash2_data, splash2_width, splash2_height, 1);
   }
 
   vccstate = vcs;
@@ -538,6 +597,7 @@ bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset,
                                           SSD1306_SETSTARTLINE | 0x0, // line #0
                                           SSD1306_CHARGEPUMP};        // 0x8D
   ssd1306_commandList(init2, sizeof(init2));
+  shiftY = 0;
 
   ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x10 : 0x14);
 
@@ -581,6 +641,11 @@ bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset,
 
   TRANSACTION_END
 
+  invalidateDisplay(); // Display RAM content is unknown
+#ifdef SSD1306_STATS
+  bytesSent = 0;
+#endif
+
   return true; // Success
 }
 
@@ -870,6 +935,239 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y,
   }   // endif x in bounds
 }
 
+// Find the pre-scaled sprite of a character, NULL if there is none
+static const uint8_t *spriteGlyph(unsigned char c, uint8_t size) {
+#ifndef SSD1306_NO_SPRITES
+  static const char PROGMEM chars[] = SSD1306_SPRITE_CHARS;
+  for (uint8_t i = 0; i < SSD1306_SPRITE_COUNT; i++) {
+    if (pgm_read_byte(&chars[i]) == c) {
+      switch (size) {
+      case 2:
+        return &sprites2_data[i * 5 * 2];
+      case 3:
+        return &sprites3_data[i * 5 * 3];
+      case 4:
+        return &sprites4_data[i * 5 * 4];
+      }
+      break;
+    }
+  }
+#endif
+  return NULL;
+}
+
+/*!
+    @brief  Write a single character (see Adafruit_GFX::writeChar(), used by
+            drawChar(), drawString() and print()). Characters of the classic
+            built-in font that lie fully on screen at rotation 0 are written
+            a column of page bytes at a time straight into the buffer: size 1
+            from the font itself, sizes 2 to 4 (square) from pre-scaled
+            sprites of the clock characters (digits, ':', 'A', 'M', 'P').
+            Everything else goes through Adafruit_GFX::writeChar().
+    @param  x
+            Left column of the character cell.
+    @param  y
+            Top row of the character cell.
+    @param  c
+            The 8-bit font-indexed character (likely ascii).
+    @param  color
+            Text color, SSD1306_WHITE or SSD1306_BLACK for the fast path.
+    @param  bg
+            Background color, same as color for transparent text.
+    @param  size_x
+            Horizontal magnification.
+    @param  size_y
+            Vertical magnification, same as size_x for the fast path.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::writeChar(int16_t x, int16_t y, unsigned char c,
+                                 uint16_t color, uint16_t bg, uint8_t size_x,
+                                 uint8_t size_y) {
+  uint8_t size = size_x;
+  const uint8_t *glyph = NULL;
+  if (!gfxFont && !rotation && (size == size_y) && (x >= 0) &&
+      (x <= WIDTH - 6 * size) && (y >= 0) && (y <= HEIGHT - 8 * size) &&
+      (color <= SSD1306_WHITE) && ((bg == color) || (bg <= SSD1306_WHITE)))
+    glyph = (size == 1) ? classicGlyph(c) : spriteGlyph(c, size);
+  if (!glyph) {
+    Adafruit_GFX::writeChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x];
+  uint8_t shift = y & 7;
+  bool opaque = (bg != color);
+  // Opaque black-on-white is white-on-black with the column bits inverted
+  uint8_t invert = (opaque && (color == SSD1306_BLACK)) ? 0xFF : 0x00;
+  uint8_t bits[4];
+
+  // Five glyph columns plus the blank spacing column, each 'size' wide
+  for (uint8_t i = 0; i < 6; i++) {
+    for (uint8_t k = 0; k < size; k++)
+      bits[k] = ((i < 5) ? pgm_read_byte(glyph++) : 0) ^ invert;
+    for (uint8_t k = 0; k < size; k++)
+      blitColumn(pBuf++, bits, size, shift, opaque, color);
+  }
+}
+
+// Write one column of a character cell, n page bytes tall, to the buffer
+// at pBuf shifted down by 'shift' rows (so it spans n + 1 pages if shift
+// is nonzero). Opaque replaces the cell rows, otherwise set bits are ORed
+// (white) or cleared (black).
+void Adafruit_SSD1306::blitColumn(uint8_t *pBuf, const uint8_t *bits,
+                                  uint8_t n, uint8_t shift, bool opaque,
+                                  uint16_t color) {
+  uint8_t carry = 0, maskCarry = 0;
+  for (uint8_t k = 0; k <= n; k++, pBuf += WIDTH) {
+    uint8_t b = 0, m = 0;
+    if (k < n) {
+      b = bits[k];
+      m = 0xFF;
+    } else if (!shift) {
+      break; // Page aligned, nothing spills into page n
+    }
+    uint8_t out = (b << shift) | carry, mask = (m << shift) | maskCarry;
+    carry = b >> (8 - shift);
+    maskCarry = m >> (8 - shift);
+    if (opaque)
+      *pBuf = (*pBuf & ~mask) | out;
+    else if (color == SSD1306_WHITE)
+      *pBuf |= out;
+    else
+      *pBuf &= ~out;
+  }
+}
+
+/*!
+    @brief  Draw a PROGMEM bitmap stored in SSD1306 page format, set bits
+            in the given color and clear bits left untouched.
+    @param  x
+            Column of top-left corner.
+    @param  y
+            Row of top-left corner.
+    @param  bitmap
+            Page-format bitmap in PROGMEM: ((h + 7) / 8) pages of w bytes,
+            each byte one column of 8 rows with the least significant bit
+            on top (the layout of the display buffer itself).
+    @param  w
+            Bitmap width in pixels.
+    @param  h
+            Bitmap height in pixels.
+    @param  color
+            Pixel color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERSE.
+    @return None (void).
+    @note   With rotation 0 and the bitmap fully inside the display
+            vertically, each bitmap byte becomes one or two buffer byte
+            writes (page-aligned or shifted by y % 8). Anything else is
+            drawn pixel by pixel.
+*/
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y,
+                                      const uint8_t bitmap[], int16_t w,
+                                      int16_t h, uint16_t color) {
+  blitPages(x, y, bitmap, w, h, color, color, false);
+}
+
+/*!
+    @brief  Draw a PROGMEM bitmap stored in SSD1306 page format, set bits
+            in the foreground color and clear bits in the background color.
+    @param  x
+            Column of top-left corner.
+    @param  y
+            Row of top-left corner.
+    @param  bitmap
+            Page-format bitmap in PROGMEM (see above).
+    @param  w
+            Bitmap width in pixels.
+    @param  h
+            Bitmap height in pixels.
+    @param  color
+            Foreground color.
+    @param  bg
+            Background color.
+    @return None (void).
+    @note   White on black with y a multiple of 8 copies whole pages
+            straight from flash with memcpy_P().
+*/
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y,
+                                      const uint8_t bitmap[], int16_t w,
+                                      int16_t h, uint16_t color, uint16_t bg) {
+  blitPages(x, y, bitmap, w, h, color, bg, true);
+}
+
+// Shared body of drawPageBitmap(). Walks the bitmap one source page at a
+// time; each source byte lands in the buffer page under it shifted down by
+// y % 8, with the bits shifted out carried into the page below.
+void Adafruit_SSD1306::blitPages(int16_t x, int16_t y, const uint8_t *bitmap,
+                                 int16_t w, int16_t h, uint16_t color,
+                                 uint16_t bg, bool opaque) {
+  bool mono =
+      (color <= SSD1306_WHITE) && (bg <= SSD1306_WHITE) && (bg != color);
+  if (getRotation() || (y < 0) || (y + h > HEIGHT) || (opaque && !mono)) {
+    startWrite();
+    for (int16_t j = 0; j < h; j++) {
+      const uint8_t *src = &bitmap[(j / 8) * w];
+      for (int16_t i = 0; i < w; i++) {
+        if (pgm_read_byte(&src[i]) & (1 << (j & 7)))
+          writePixel(x + i, y + j, color);
+        else if (opaque)
+          writePixel(x + i, y + j, bg);
+      }
+    }
+    endWrite();
+    return;
+  }
+
+  // Clip columns to the buffer
+  int16_t first = (x < 0) ? -x : 0, last = (x + w > WIDTH) ? WIDTH - x : w;
+  if (first >= last)
+    return;
+  uint8_t n = last - first, shift = y & 7, pages = (h + 7) / 8;
+  uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x + first];
+  const uint8_t *src = bitmap + first;
+  // Opaque black-on-white is white-on-black with the bits inverted
+  uint8_t invert = (opaque && (color == SSD1306_BLACK)) ? 0xFF : 0x00;
+
+  for (uint8_t p = 0; p < pages; p++, src += w, pBuf += WIDTH) {
+    // Rows of this page that belong to the bitmap (the last may be partial)
+    uint8_t m = ((p == pages - 1) && (h & 7)) ? (1 << (h & 7)) - 1 : 0xFF;
+    if (opaque && !invert && !shift && (m == 0xFF)) {
+      memcpy_P(pBuf, src, n);
+      continue;
+    }
+    uint8_t mLo = m << shift, mHi = m >> (8 - shift);
+    uint8_t *pLo = pBuf, *pHi = pBuf + WIDTH;
+    for (uint8_t i = 0; i < n; i++) {
+      uint8_t b = (pgm_read_byte(&src[i]) ^ invert) & m;
+      uint8_t lo = b << shift, hi = b >> (8 - shift);
+      if (opaque) {
+        pLo[i] = (pLo[i] & ~mLo) | lo;
+        if (mHi)
+          pHi[i] = (pHi[i] & ~mHi) | hi;
+      } else {
+        switch (color) {
+        case SSD1306_WHITE:
+          pLo[i] |= lo;
+          if (mHi)
+            pHi[i] |= hi;
+          break;
+        case SSD1306_BLACK:
+          pLo[i] &= ~lo;
+          if (mHi)
+            pHi[i] &= ~hi;
+          break;
+        case SSD1306_INVERSE:
+          pLo[i] ^= lo;
+          if (mHi)
+            pHi[i] ^= hi;
+          break;
+        }
+      }
+    }
+  }
+}
+
 /*!
     @brief  Return color of a single pixel in display buffer.
     @param  x
@@ -912,23 +1210,35 @@ uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
 
 // REFRESH DISPLAY ---------------------------------------------------------
 
+// CRC-16-CCITT (reflected, as avr-libc _crc_ccitt_update()) of one page.
+// Unlike a sum, it catches every single-pixel change, move or swap within
+// the page, so an unchanged checksum really means unchanged pixels.
+static uint16_t pageChecksum(const uint8_t *ptr, uint8_t count) {
+  uint16_t crc = 0xFFFF;
+  while (count--) {
+    uint8_t data = *ptr++ ^ (uint8_t)crc;
+    data ^= data << 4;
+    crc = (((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4) ^
+          ((uint16_t)data << 3);
+  }
+  return crc;
+}
+
 /*!
     @brief  Push data currently in RAM to SSD1306 display.
     @return None (void).
     @note   Drawing operations are not visible until this function is
             called. Call after each graphics command, or after a whole set
             of graphics commands, as best needed by one's own application.
+            Only pages (8-pixel rows) whose content changed since the last
+            call are transmitted; a checksum of each page is kept for that.
+            Redrawing identical content therefore costs no bus time.
 */
 void Adafruit_SSD1306::display(void) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM dlist1[] = {
-      SSD1306_PAGEADDR,
-      0,                      // Page start address
-      0xFF,                   // Page end (not really, but works here)
-      SSD1306_COLUMNADDR, 0}; // Column start address
-  ssd1306_commandList(dlist1, sizeof(dlist1));
-  ssd1306_command1(WIDTH - 1); // Column end address
+  uint8_t pages = (HEIGHT + 7) / 8;
+  uint8_t *ptr = buffer;
 
+  TRANSACTION_START
 #if defined(ESP8266)
   // ESP8266 needs a periodic yield() call to avoid watchdog reset.
   // With the limited size of SSD1306 displays, and the fast bitrate
@@ -938,17 +1248,66 @@ void Adafruit_SSD1306::display(void) {
   // 32-byte transfer condition below.
   yield();
 #endif
-  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr = buffer;
+  // Send each run of consecutive changed pages as one window
+  int8_t first = -1;
+  for (uint8_t page = 0; page < pages; page++, ptr += WIDTH) {
+    bool changed = true;
+    if (page < SSD1306_MAX_PAGES) {
+      uint16_t sum = pageChecksum(ptr, WIDTH);
+      changed = !pageSumValid || (sum != pageSum[page]);
+      pageSum[page] = sum;
+    }
+    if (changed) {
+      if (first < 0)
+        first = page;
+    } else if (first >= 0) {
+      displayPages(first, page - 1);
+      first = -1;
+    }
+  }
+  if (first >= 0)
+    displayPages(first, pages - 1);
+  pageSumValid = true;
+  TRANSACTION_END
+#if defined(ESP8266)
+  yield();
+#endif
+}
+
+/*!
+    @brief  Force the next display() call to transmit the whole buffer,
+            regardless of which pages changed.
+    @return None (void).
+    @note   Use after anything that alters display RAM behind the
+            library's back (e.g. a display reset or power cycle).
+*/
+void Adafruit_SSD1306::invalidateDisplay(void) { pageSumValid = false; }
+
+// Send buffer pages first to last (inclusive) to the display.
+// Transaction must be started/ended in calling function.
+void Adafruit_SSD1306::displayPages(uint8_t first, uint8_t last) {
+  uint8_t window[] = {SSD1306_PAGEADDR,
+                      first, // Page start address
+                      last,  // Page end address
+                      SSD1306_COLUMNADDR,
+                      0,                      // Column start address
+                      (uint8_t)(WIDTH - 1)}; // Column end address
+  ssd1306_commandBuffer(window, sizeof(window));
+
+  uint16_t count = WIDTH * (last - first + 1);
+  uint8_t *ptr = buffer + WIDTH * first;
+  STATS_COUNT(count);
   if (wire) { // I2C
     wire->beginTransmission(i2caddr);
     WIRE_WRITE((uint8_t)0x40);
+    STATS_COUNT(2);
     uint8_t bytesOut = 1;
     while (count--) {
       if (bytesOut >= WIRE_MAX) {
         wire->endTransmission();
         wire->beginTransmission(i2caddr);
         WIRE_WRITE((uint8_t)0x40);
+        STATS_COUNT(2);
         bytesOut = 1;
       }
       WIRE_WRITE(*ptr++);
@@ -957,13 +1316,8 @@ void Adafruit_SSD1306::display(void) {
     wire->endTransmission();
   } else { // SPI
     SSD1306_MODE_DATA
-    while (count--)
-      SPIwrite(*ptr++);
+    SPIwriteBlock(ptr, count);
   }
-  TRANSACTION_END
-#if defined(ESP8266)
-  yield();
-#endif
 }
 
 // SCROLLING FUNCTIONS -----------------------------------------------------
@@ -1074,10 +1428,39 @@ void Adafruit_SSD1306::stopscroll(void) {
   TRANSACTION_START
   ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
   TRANSACTION_END
+  invalidateDisplay(); // Scrolling moved display RAM, it must be rewritten
 }
 
 // OTHER HARDWARE SETTINGS -------------------------------------------------
 
+/*!
+    @brief  Move the whole image up or down by a few pixels using the
+            controller's display offset register, to spread OLED wear on
+            screens that show a static layout.
+    @param  dy
+            Vertical shift in pixels, positive moves the image down.
+            0 restores the normal position.
+    @return None (void).
+    @note   This has an immediate effect on the display, no need to call the
+            display() function -- buffer contents are not changed and no
+            frame is transferred, only a 2-byte command. The offset wraps
+            around, so rows pushed off one edge reappear on the other; keep
+            that many rows blank at the top and bottom of the layout. The
+            SSD1306 has no horizontal equivalent (segment remap only mirrors
+            the image), so only vertical shifting is supported.
+*/
+void Adafruit_SSD1306::pixelShift(int8_t dy) {
+  if (dy == shiftY)
+    return;
+  shiftY = dy;
+  // Display RAM row (r + offset) is shown on screen row r
+  uint8_t cmd[] = {SSD1306_SETDISPLAYOFFSET,
+                   (uint8_t)((HEIGHT - dy) % HEIGHT)};
+  TRANSACTION_START
+  ssd1306_commandBuffer(cmd, sizeof(cmd));
+  TRANSACTION_END
+}
+
 /*!
     @brief  Enable or disable display invert mode (white-on-black vs
             black-on-white).
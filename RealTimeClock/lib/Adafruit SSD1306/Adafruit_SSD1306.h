@@ -94,6 +94,8 @@ typedef uint32_t PortMask;
 #define SSD1306_SETHIGHCOLUMN 0x10 ///< Not currently used
 #define SSD1306_SETSTARTLINE 0x40  ///< See datasheet
 
+#define SSD1306_MAX_PAGES 8 ///< Pages tracked by display() checksums
+
 #define SSD1306_EXTERNALVCC 0x01  ///< External display voltage source
 #define SSD1306_SWITCHCAPVCC 0x02 ///< Gen. display voltage from 3.3V
 
@@ -145,31 +147,57 @@ public:
   bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0,
              bool reset = true, bool periphBegin = true);
   void display(void);
+  void invalidateDisplay(void);
   void clearDisplay(void);
   void invertDisplay(bool i);
   void dim(bool dim);
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void writeChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                 uint16_t bg, uint8_t size_x, uint8_t size_y);
+  void drawPageBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                      int16_t h, uint16_t color);
+  void drawPageBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                      int16_t h, uint16_t color, uint16_t bg);
   void startscrollright(uint8_t start, uint8_t stop);
   void startscrollleft(uint8_t start, uint8_t stop);
   void startscrolldiagright(uint8_t start, uint8_t stop);
   void startscrolldiagleft(uint8_t start, uint8_t stop);
   void stopscroll(void);
+  void pixelShift(int8_t dy);
   void ssd1306_command(uint8_t c);
   bool getPixel(int16_t x, int16_t y);
   uint8_t *getBuffer(void);
+#ifdef SSD1306_STATS
+  uint32_t getBytesSent(void) const { return bytesSent; }
+  void resetBytesSent(void) { bytesSent = 0; }
+#endif
 
-private:
-  inline void SPIwrite(uint8_t d) __attribute__((always_inline));
+protected:
+  // Unrotated line fills, also used by Adafruit_SSD1306_Fixed
   void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color);
   void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+private:
+  inline void SPIwrite(uint8_t d) __attribute__((always_inline));
+  void SPIwriteBlock(const uint8_t *ptr, uint16_t count);
+  void blitColumn(uint8_t *pBuf, const uint8_t *bits, uint8_t n, uint8_t shift,
+                  bool opaque, uint16_t color);
+  void blitPages(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                 int16_t h, uint16_t color, uint16_t bg, bool opaque);
+  void displayPages(uint8_t first, uint8_t last);
   void ssd1306_command1(uint8_t c);
   void ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void ssd1306_commandBuffer(const uint8_t *c, uint8_t n);
 
   SPIClass *spi;
   TwoWire *wire;
-  uint8_t *buffer;
+
+protected:
+  uint8_t *buffer; // display buffer, malloc'd by begin() unless already set
+
+private:
   int8_t i2caddr, vccstate, page_end;
   int8_t mosiPin, clkPin, dcPin, csPin, rstPin;
 #ifdef HAVE_PORTREG
@@ -181,6 +209,12 @@ private:
   uint32_t restoreClk; // Wire speed following SSD1306 transfers
 #endif
   uint8_t contrast; // normal contrast setting for this device
+  int8_t shiftY;    // current hardware display offset (see pixelShift())
+  bool pageSumValid; // false until every page has been sent once
+  uint16_t pageSum[SSD1306_MAX_PAGES]; // checksum of last page sent
+#ifdef SSD1306_STATS
+  uint32_t bytesSent; // bytes on the wire, incl. I2C address/control bytes
+#endif
 #if defined(SPI_HAS_TRANSACTION)
 protected:
   // Allow sub-class to change
@@ -188,4 +222,104 @@ protected:
 #endif
 };
 
+/*!
+    @brief  SSD1306 display with geometry fixed at compile time.
+            The buffer is part of the object (no malloc in begin()) and the
+            rotation is always 0, so drawPixel() and the fast line calls
+            reduce to constant buffer math that the compiler inlines when
+            called on the object. The class is final, which lets calls made
+            directly on it bypass the virtual table.
+    @tparam W
+            Display width in pixels.
+    @tparam H
+            Display height in pixels.
+*/
+template <uint8_t W, uint8_t H>
+class Adafruit_SSD1306_Fixed final : public Adafruit_SSD1306 {
+public:
+  Adafruit_SSD1306_Fixed(TwoWire *twi = &Wire, int8_t rst_pin = -1,
+                         uint32_t clkDuring = 400000UL,
+                         uint32_t clkAfter = 100000UL)
+      : Adafruit_SSD1306(W, H, twi, rst_pin, clkDuring, clkAfter) {
+    buffer = frame;
+  }
+  Adafruit_SSD1306_Fixed(SPIClass *spi, int8_t dc_pin, int8_t rst_pin,
+                         int8_t cs_pin, uint32_t bitrate = 8000000UL)
+      : Adafruit_SSD1306(W, H, spi, dc_pin, rst_pin, cs_pin, bitrate) {
+    buffer = frame;
+  }
+  ~Adafruit_SSD1306_Fixed(void) { buffer = NULL; } // Not ours to free
+
+  void clearDisplay(void) { memset(frame, 0, sizeof(frame)); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    // Unsigned compare rejects negative coordinates as well
+    if (((uint16_t)x < W) && ((uint16_t)y < H)) {
+      uint8_t *p = &frame[(uint8_t)x + ((uint8_t)y / 8) * W];
+      uint8_t mask = 1 << (y & 7);
+      switch (color) {
+      case SSD1306_WHITE:
+        *p |= mask;
+        break;
+      case SSD1306_BLACK:
+        *p &= ~mask;
+        break;
+      case SSD1306_INVERSE:
+        *p ^= mask;
+        break;
+      }
+    }
+  }
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    drawPixel(x, y, color);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if ((uint16_t)y >= H)
+      return;
+    if (x < 0) { // Clip left
+      w += x;
+      x = 0;
+    }
+    if ((x + w) > W) // Clip right
+      w = W - x;
+    if (w <= 0)
+      return;
+    uint8_t *p = &frame[(uint8_t)x + ((uint8_t)y / 8) * W];
+    uint8_t mask = 1 << (y & 7), n = w;
+    switch (color) {
+    case SSD1306_WHITE:
+      do {
+        *p++ |= mask;
+      } while (--n);
+      break;
+    case SSD1306_BLACK:
+      mask = ~mask;
+      do {
+        *p++ &= mask;
+      } while (--n);
+      break;
+    case SSD1306_INVERSE:
+      do {
+        *p++ ^= mask;
+      } while (--n);
+      break;
+    }
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawFastVLineInternal(x, y, h, color); // Rotation is always 0
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+  }
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawFastVLineInternal(x, y, h, color);
+  }
+
+  void setRotation(uint8_t) {} // Geometry is fixed
+
+private:
+  uint8_t frame[W * ((H + 7) / 8)];
+};
+
 #endif // _Adafruit_SSD1306_H_
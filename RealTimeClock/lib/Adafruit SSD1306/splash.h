@@ -1,182 +1,109 @@
 
+// Splash images in SSD1306 page format for drawPageBitmap(): one byte per
+// column per 8-pixel page, least significant bit on top, pages in order.
+
 #define splash1_width 82
 #define splash1_height 64
 
 const uint8_t PROGMEM splash1_data[] = {
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000001, B10000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000011, B10000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000111,
-    B11000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000111, B11000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00001111, B11000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00011111, B11100000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00011111, B11100000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11100000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00111111, B11110000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B01111111,
-    B11110000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00011111, B11111000, B01111111, B11110000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00111111, B11111110,
-    B01111111, B11110000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00111111, B11111111, B01111111, B11110000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00011111,
-    B11111111, B11111011, B11100000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00001111, B11111111, B11111001, B11111111,
-    B11000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00001111, B11111111, B11111001, B11111111, B11111000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000111, B11111111, B11110001,
-    B11111111, B11111111, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000011, B11111100, B01110011, B11111111, B11111111, B10000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000001, B11111110,
-    B00111111, B11111111, B11111111, B10000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B11111111, B00011110, B00001111, B11111111,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B01111111, B11111110, B00011111, B11111100, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00111111, B11111111, B11111111,
-    B11111000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00001111, B11011111, B11111111, B11100000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00011111, B00011001,
-    B11111111, B11000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00111111, B00111100, B11111111, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B01111110,
-    B01111100, B11111000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B01111111, B11111110, B01111100, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B11111111, B11111111, B11111100, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B11111111, B11111111, B11111110,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B11111111, B11111111, B11111110, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000001, B11111111, B11101111,
-    B11111110, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000001, B11111111, B11001111, B11111110, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000011, B11111111,
-    B00000111, B11111110, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000011, B11111100, B00000111, B11111110, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000011,
-    B11110000, B00000011, B11111110, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000001, B10000000, B00000000, B11111110,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B01111110, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00111110, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00001100, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000111, B10000000, B00000000,
-    B11111100, B00000000, B00000000, B00000011, B11000000, B00000000, B00000000,
-    B00000000, B00000111, B10000000, B00000001, B11111100, B00000000, B00000000,
-    B00000011, B11000000, B00000000, B00000000, B00000000, B00000111, B10000000,
-    B00000001, B11111100, B00000000, B00000000, B00000011, B11000000, B00000000,
-    B00000000, B00000000, B00000111, B10000000, B00000001, B11100000, B00000000,
-    B00000000, B00000000, B00011110, B00000000, B00000000, B00000000, B00000111,
-    B10000000, B00000001, B11100000, B00000000, B00000000, B00000000, B00011110,
-    B00000000, B01111111, B11100011, B11110111, B10011111, B11111001, B11111101,
-    B11100111, B01111000, B01111011, B11011111, B11000000, B11111111, B11110111,
-    B11111111, B10111111, B11111101, B11111101, B11111111, B01111000, B01111011,
-    B11011111, B11000000, B11111111, B11110111, B11111111, B10111111, B11111101,
-    B11111101, B11111111, B01111000, B01111011, B11011111, B11000000, B11110000,
-    B11110111, B10000111, B10111100, B00111101, B11100001, B11111111, B01111000,
-    B01111011, B11011110, B00000000, B11110000, B11110111, B10000111, B10111100,
-    B00111101, B11100001, B11110000, B01111000, B01111011, B11011110, B00000000,
-    B00000000, B11110111, B10000111, B10000000, B00111101, B11100001, B11100000,
-    B01111000, B01111011, B11011110, B00000000, B01111111, B11110111, B10000111,
-    B10011111, B11111101, B11100001, B11100000, B01111000, B01111011, B11011110,
-    B00000000, B11111111, B11110111, B10000111, B10111111, B11111101, B11100001,
-    B11100000, B01111000, B01111011, B11011110, B00000000, B11110000, B11110111,
-    B10000111, B10111100, B00111101, B11100001, B11100000, B01111000, B01111011,
-    B11011110, B00000000, B11110000, B11110111, B10000111, B10111100, B00111101,
-    B11100001, B11100000, B01111000, B01111011, B11011110, B00000000, B11110000,
-    B11110111, B10000111, B10111100, B00111101, B11100001, B11100000, B01111000,
-    B01111011, B11011110, B00000000, B11111111, B11110111, B11111111, B10111111,
-    B11111101, B11100001, B11100000, B01111111, B11111011, B11011111, B11000000,
-    B11111111, B11110111, B11111111, B10111111, B11111101, B11100001, B11100000,
-    B01111111, B11111011, B11011111, B11000000, B01111100, B11110011, B11110011,
-    B10011111, B00111101, B11100001, B11100000, B00111110, B01111011, B11001111,
-    B11000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B11111111, B11111111,
-    B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11111111,
-    B11111111, B11000000, B11111111, B11111111, B11111111, B11111111, B11111101,
-    B01101000, B11011011, B00010001, B00011010, B00110001, B11000000, B11111111,
-    B11111111, B11111111, B11111111, B11111101, B00101011, B01011010, B11111011,
-    B01101010, B11101111, B11000000, B11111111, B11111111, B11111111, B11111111,
-    B11111101, B01001011, B01011011, B00111011, B00011010, B00110011, B11000000,
-    B11111111, B11111111, B11111111, B11111111, B11111101, B01101011, B01011011,
-    B11011011, B01101010, B11111101, B11000000,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF,
+    0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x3C, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+    0xF8, 0xF0, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0xBF, 0xFF, 0xFF, 0xFD, 0xF9,
+    0x71, 0x73, 0x37, 0xFF, 0xFC, 0x7C, 0x7E, 0xE7, 0xE7, 0xE7, 0xE7, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFE,
+    0x7F, 0x3F, 0xFF, 0xFF, 0xFC, 0xF8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0xF1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F,
+    0x0F, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x83, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70, 0x70, 0xF0, 0xF0,
+    0xF0, 0xE0, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70, 0x60, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70, 0x70,
+    0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x73, 0x73,
+    0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0x00, 0xF0,
+    0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+    0xF3, 0xF3, 0xF3, 0xF3, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x70, 0x70, 0x70,
+    0xF9, 0xFD, 0xFD, 0xFD, 0x8C, 0x8C, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xF9, 0xFD, 0xFD, 0xFD, 0x8C, 0x8C, 0x8C, 0x8C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xF9, 0xFB,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF9,
+    0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xF8,
+    0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB,
+    0x08, 0xFB, 0x0B, 0xDB, 0xBB, 0x08, 0xF8, 0x08, 0xE8, 0xEB, 0x1B, 0xFB,
+    0x0B, 0xF8, 0xF8, 0x08, 0xF8, 0xD8, 0xA8, 0xA9, 0x6B, 0xFB, 0xEB, 0x0B,
+    0xEB, 0xF9, 0x09, 0xAB, 0xAB, 0x5B, 0xFB, 0x08, 0xFB, 0x0B, 0xAB, 0xAB,
+    0xF8, 0xD9, 0xAB, 0xAB, 0x6B, 0xFB, 0xFB, 0xFB
 };
 
 #define splash2_width 115
 #define splash2_height 32
 
 const uint8_t PROGMEM splash2_data[] = {
-    B00000000, B00000000, B01100000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B11100000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000001, B11100000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000001, B11110000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000011, B11110000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000111,
-    B11110000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000111, B11111000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00001111, B11111000, B00000000, B00000000, B00000000, B00000011,
-    B11000000, B00000000, B01111110, B00000000, B00000000, B00000001, B11100000,
-    B00000000, B01111111, B00001111, B11111000, B00000000, B00000000, B00000000,
-    B00000011, B11000000, B00000000, B11111110, B00000000, B00000000, B00000001,
-    B11100000, B00000000, B11111111, B11101111, B11111000, B00000000, B00000000,
-    B00000000, B00000011, B11000000, B00000000, B11111110, B00000000, B00000000,
-    B00000001, B11100000, B00000000, B11111111, B11111111, B11111000, B00000000,
-    B00000000, B00000000, B00000011, B11000000, B00000000, B11110000, B00000000,
-    B00000000, B00000000, B00001111, B00000000, B01111111, B11111110, B01111111,
-    B11000000, B00000000, B00000000, B00000011, B11000000, B00000000, B11110000,
-    B00000000, B00000000, B00000000, B00001111, B00000000, B00111111, B11111110,
-    B01111111, B11111000, B00111111, B11110001, B11111011, B11001111, B11111100,
-    B11111110, B11110011, B10111100, B00111101, B11101111, B11100000, B00011111,
-    B11111110, B01111111, B11111111, B01111111, B11111011, B11111111, B11011111,
-    B11111110, B11111110, B11111111, B10111100, B00111101, B11101111, B11100000,
-    B00011111, B11000110, B11111111, B11111111, B01111111, B11111011, B11111111,
-    B11011111, B11111110, B11111110, B11111111, B10111100, B00111101, B11101111,
-    B11100000, B00001111, B11100011, B11000111, B11111110, B01111000, B01111011,
-    B11000011, B11011110, B00011110, B11110000, B11111111, B10111100, B00111101,
-    B11101111, B00000000, B00000111, B11111111, B10000111, B11111100, B01111000,
-    B01111011, B11000011, B11011110, B00011110, B11110000, B11111000, B00111100,
-    B00111101, B11101111, B00000000, B00000001, B11111111, B11111111, B11110000,
-    B00000000, B01111011, B11000011, B11000000, B00011110, B11110000, B11110000,
-    B00111100, B00111101, B11101111, B00000000, B00000001, B11110011, B01111111,
-    B11100000, B00111111, B11111011, B11000011, B11001111, B11111110, B11110000,
-    B11110000, B00111100, B00111101, B11101111, B00000000, B00000011, B11100011,
-    B00111111, B10000000, B01111111, B11111011, B11000011, B11011111, B11111110,
-    B11110000, B11110000, B00111100, B00111101, B11101111, B00000000, B00000111,
-    B11100111, B00111100, B00000000, B01111000, B01111011, B11000011, B11011110,
-    B00011110, B11110000, B11110000, B00111100, B00111101, B11101111, B00000000,
-    B00000111, B11111111, B10111110, B00000000, B01111000, B01111011, B11000011,
-    B11011110, B00011110, B11110000, B11110000, B00111100, B00111101, B11101111,
-    B00000000, B00000111, B11111111, B11111110, B00000000, B01111000, B01111011,
-    B11000011, B11011110, B00011110, B11110000, B11110000, B00111100, B00111101,
-    B11101111, B00000000, B00001111, B11111111, B11111110, B00000000, B01111111,
-    B11111011, B11111111, B11011111, B11111110, B11110000, B11110000, B00111111,
-    B11111101, B11101111, B11100000, B00001111, B11111111, B11111111, B00000000,
-    B01111111, B11111011, B11111111, B11011111, B11111110, B11110000, B11110000,
-    B00111111, B11111101, B11101111, B11100000, B00001111, B11111001, B11111111,
-    B00000000, B00111110, B01111001, B11111001, B11001111, B10011110, B11110000,
-    B11110000, B00011111, B00111101, B11100111, B11100000, B00011111, B11110001,
-    B11111111, B00000000, B00000000, B00000000, B00000000, B00000000, B00000000,
-    B00000000, B00000000, B00000000, B00000000, B00000000, B00000000, B00011111,
-    B10000000, B11111111, B00000000, B01111111, B11111111, B11111111, B11111111,
-    B11111111, B11111111, B11111111, B11111111, B11111111, B11111111, B11100000,
-    B00011100, B00000000, B01111111, B00000000, B01111111, B11111111, B11111111,
-    B11111111, B11111110, B10110100, B01101101, B10001000, B10001101, B00011000,
-    B11100000, B00000000, B00000000, B00011111, B00000000, B01111111, B11111111,
-    B11111111, B11111111, B11111110, B10010101, B10101101, B01111101, B10110101,
-    B01110111, B11100000, B00000000, B00000000, B00001111, B00000000, B01111111,
-    B11111111, B11111111, B11111111, B11111110, B10100101, B10101101, B10011101,
-    B10001101, B00011001, B11100000, B00000000, B00000000, B00000110, B00000000,
-    B01111111, B11111111, B11111111, B11111111, B11111110, B10110101, B10101101,
-    B11101101, B10110101, B01111110, B11100000,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xF8, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0F, 0x1F, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xBE, 0x3C, 0x3F, 0x7F, 0xFF, 0x87, 0xC7,
+    0xFF, 0x7F, 0x7F, 0x7F, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0,
+    0xE0, 0xE0, 0x60, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70, 0x70,
+    0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70,
+    0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xF0, 0xF0, 0xF0, 0x70, 0x70,
+    0x70, 0x70, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x73,
+    0x73, 0x73, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0,
+    0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0,
+    0xF0, 0x00, 0xF3, 0xF3, 0xF3, 0xF3, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x70,
+    0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF1, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE7, 0xE3, 0xF3, 0xFF, 0xFF, 0xE3, 0xC6, 0xFE, 0xFE, 0xFE, 0xFF,
+    0xEF, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0xF9,
+    0xFD, 0xFD, 0xFD, 0x8C, 0x8C, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xF9, 0xFD, 0xFD, 0xFD, 0x8C, 0x8C, 0x8C, 0x8C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x1C, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x01, 0x01,
+    0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+    0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xF8, 0xF9, 0xFB, 0xFB, 0xFB,
+    0xFB, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0x08, 0xFB, 0x0B, 0xDB,
+    0xBB, 0x08, 0xF8, 0x08, 0xE8, 0xEB, 0x1B, 0xFB, 0x0B, 0xF8, 0xF8, 0x08,
+    0xF8, 0xD8, 0xA8, 0xA9, 0x6B, 0xFB, 0xEB, 0x0B, 0xEB, 0xF9, 0x09, 0xAB,
+    0xAB, 0x5B, 0xFB, 0x08, 0xFB, 0x0B, 0xAB, 0xAB, 0xF8, 0xD9, 0xAB, 0xAB,
+    0x6B, 0xFB, 0xFB, 0xFB
 };
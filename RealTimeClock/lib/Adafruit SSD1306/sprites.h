@@ -0,0 +1,74 @@
+// Pre-scaled clock glyphs for Adafruit_SSD1306::writeChar().
+//
+// The digits, colon, 'A', 'M' and 'P' of the classic 5x7 GFX font are
+// stretched vertically at compile time for text sizes 2 to 4. Each font
+// column becomes 'size' page bytes (top page first), so a size N glyph is
+// 5 x N bytes. Horizontal scaling is done when the glyph is drawn, by
+// repeating each column N times.
+//
+// Define SSD1306_NO_SPRITES to leave the tables out and draw large text
+// through the generic GFX path.
+
+#ifndef _SSD1306_SPRITES_H_
+#define _SSD1306_SPRITES_H_
+
+// Characters with sprites, in table order
+#define SSD1306_SPRITE_CHARS "0123456789:AMP"
+#define SSD1306_SPRITE_COUNT 14 // Glyphs per sprite table
+
+// Column bytes copied from glcdfont.c, bit 0 on top
+#define SSD1306_SPRITE_GLYPHS(G)                                               \
+  G(0x3E, 0x51, 0x49, 0x45, 0x3E) /* 0 */                                      \
+  G(0x00, 0x42, 0x7F, 0x40, 0x00) /* 1 */                                      \
+  G(0x72, 0x49, 0x49, 0x49, 0x46) /* 2 */                                      \
+  G(0x21, 0x41, 0x49, 0x4D, 0x33) /* 3 */                                      \
+  G(0x18, 0x14, 0x12, 0x7F, 0x10) /* 4 */                                      \
+  G(0x27, 0x45, 0x45, 0x45, 0x39) /* 5 */                                      \
+  G(0x3C, 0x4A, 0x49, 0x49, 0x31) /* 6 */                                      \
+  G(0x41, 0x21, 0x11, 0x09, 0x07) /* 7 */                                      \
+  G(0x36, 0x49, 0x49, 0x49, 0x36) /* 8 */                                      \
+  G(0x46, 0x49, 0x49, 0x29, 0x1E) /* 9 */                                      \
+  G(0x00, 0x00, 0x14, 0x00, 0x00) /* : */                                      \
+  G(0x7C, 0x12, 0x11, 0x12, 0x7C) /* A */                                      \
+  G(0x7F, 0x02, 0x1C, 0x02, 0x7F) /* M */                                      \
+  G(0x7F, 0x09, 0x09, 0x09, 0x06) /* P */
+
+// Repeat every bit of an 8-bit font column 'size' times (size 1 to 4)
+constexpr uint32_t ssd1306_spread(uint8_t bits, uint8_t size,
+                                  uint8_t bit = 0) {
+  return (bit == 8) ? 0
+                    : ((((bits >> bit) & 1) ? ((1UL << size) - 1) : 0)
+                       << (bit * size)) |
+                          ssd1306_spread(bits, size, bit + 1);
+}
+
+// Page byte k of a spread column
+#define SSD1306_SPREAD(b, size, k)                                             \
+  (uint8_t)(ssd1306_spread(b, size) >> (8 * (k)))
+
+#define SSD1306_COL2(b) SSD1306_SPREAD(b, 2, 0), SSD1306_SPREAD(b, 2, 1),
+#define SSD1306_COL3(b)                                                        \
+  SSD1306_SPREAD(b, 3, 0), SSD1306_SPREAD(b, 3, 1), SSD1306_SPREAD(b, 3, 2),
+#define SSD1306_COL4(b)                                                        \
+  SSD1306_SPREAD(b, 4, 0), SSD1306_SPREAD(b, 4, 1), SSD1306_SPREAD(b, 4, 2),   \
+      SSD1306_SPREAD(b, 4, 3),
+
+#define SSD1306_GLYPH2(c0, c1, c2, c3, c4)                                     \
+  SSD1306_COL2(c0) SSD1306_COL2(c1) SSD1306_COL2(c2) SSD1306_COL2(c3)          \
+      SSD1306_COL2(c4)
+#define SSD1306_GLYPH3(c0, c1, c2, c3, c4)                                     \
+  SSD1306_COL3(c0) SSD1306_COL3(c1) SSD1306_COL3(c2) SSD1306_COL3(c3)          \
+      SSD1306_COL3(c4)
+#define SSD1306_GLYPH4(c0, c1, c2, c3, c4)                                     \
+  SSD1306_COL4(c0) SSD1306_COL4(c1) SSD1306_COL4(c2) SSD1306_COL4(c3)          \
+      SSD1306_COL4(c4)
+
+const uint8_t PROGMEM sprites2_data[] = {SSD1306_SPRITE_GLYPHS(SSD1306_GLYPH2)};
+const uint8_t PROGMEM sprites3_data[] = {SSD1306_SPRITE_GLYPHS(SSD1306_GLYPH3)};
+const uint8_t PROGMEM sprites4_data[] = {SSD1306_SPRITE_GLYPHS(SSD1306_GLYPH4)};
+
+static_assert(sizeof(sprites4_data) == SSD1306_SPRITE_COUNT * 5 * 4 &&
+                  sizeof(SSD1306_SPRITE_CHARS) == SSD1306_SPRITE_COUNT + 1,
+              "sprite tables out of step with SSD1306_SPRITE_CHARS");
+
+#endif // _SSD1306_SPRITES_H_
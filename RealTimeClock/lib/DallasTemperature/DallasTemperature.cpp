@@ -50,6 +50,7 @@ DallasTemperature::DallasTemperature() {
 	setAlarmHandler(NO_ALARM_HANDLER);
 #endif
     useExternalPullup = false;
+    clearStats();
 }
 
 DallasTemperature::DallasTemperature(OneWire* _oneWire) : DallasTemperature() {
@@ -106,22 +107,46 @@ void DallasTemperature::begin(void) {
 	devices = 0; // Reset the number of devices when we enumerate wire devices
 	ds18Count = 0; // Reset number of DS18xxx Family devices
 
-	while (_wire->search(deviceAddress)) {
+	while (_wire->search(deviceAddress))
+		addDevice(deviceAddress);
+}
 
-		if (validAddress(deviceAddress)) {
-			devices++;
+// counts a device found by a search, see OneWireSearch for looking for
+// devices in the background instead of all at once in begin()
+bool DallasTemperature::addDevice(const uint8_t* deviceAddress) {
 
-			if (validFamily(deviceAddress)) {
-				ds18Count++;
+	if (!validAddress(deviceAddress)) return false;
+	devices++;
 
-				if (!parasite && readPowerSupply(deviceAddress))
-					parasite = true;
+	if (!validFamily(deviceAddress)) return false;
+	ds18Count++;
 
-				uint8_t b = getResolution(deviceAddress);
-				if (b > bitResolution) bitResolution = b;
-			}
-		}
-	}
+	if (!parasite && readPowerSupply(deviceAddress))
+		parasite = true;
+
+	uint8_t b = getResolution(deviceAddress);
+	if (b > bitResolution) bitResolution = b;
+	return true;
+}
+
+// adds a device known from an earlier search, e.g. kept in EEPROM by the
+// sketch; a Match ROM and scratchpad read with a good CRC replaces the
+// search, power supply and resolution reads of addDevice()
+bool DallasTemperature::addCachedDevice(const uint8_t* deviceAddress,
+		uint8_t resolution, bool parasitePower) {
+
+	if (!validAddress(deviceAddress) || !validFamily(deviceAddress))
+		return false;
+	if (!isConnected(deviceAddress))
+		return false;
+
+	devices++;
+	ds18Count++;
+	if (parasitePower)
+		parasite = true;
+	if (resolution > bitResolution && resolution <= 12)
+		bitResolution = resolution;
+	return true;
 }
 
 // returns the number of devices found on the bus
@@ -168,8 +193,7 @@ bool DallasTemperature::isConnected(const uint8_t* deviceAddress) {
 // also allows for updating the read scratchpad
 bool DallasTemperature::isConnected(const uint8_t* deviceAddress,
 		uint8_t* scratchPad) {
-	bool b = readScratchPad(deviceAddress, scratchPad);
-	return b && !isAllZeros(scratchPad) && (_wire->crc8(scratchPad, 8) == scratchPad[SCRATCHPAD_CRC]);
+	return readScratchPad(deviceAddress, scratchPad);
 }
 
 bool DallasTemperature::readScratchPad(const uint8_t* deviceAddress,
@@ -196,12 +220,23 @@ bool DallasTemperature::readScratchPad(const uint8_t* deviceAddress,
 	// byte 7: DS18S20: COUNT_PER_C
 	//         DS18B20 & DS1822: store for crc
 	// byte 8: SCRATCHPAD_CRC
-	for (uint8_t i = 0; i < 9; i++) {
-		scratchPad[i] = _wire->read();
-	}
+	//
+	// CRC and all zeros (bus held low) are checked as the bytes arrive.
+	// Bit 7 of byte 4 is always 0 and bit 4 is 1 except on the DS18S20,
+	// where the whole byte is 0xFF; if it does not match, nothing valid
+	// can follow and the read stops there.  Family 0x3B is shared by the
+	// DS1825 and the MAX31850, whose byte 4 has bit 7 set, so only bit 4
+	// is checked there.
+	uint8_t r;
+	if (deviceAddress[0] == DS18S20MODEL)
+		r = _wire->read_bytes_crc8(scratchPad, 9, CONFIGURATION, 0xFF, 0xFF);
+	else if (deviceAddress[0] == DS1825MODEL)
+		r = _wire->read_bytes_crc8(scratchPad, 9, CONFIGURATION, 0x10, 0x10);
+	else
+		r = _wire->read_bytes_crc8(scratchPad, 9, CONFIGURATION, 0x90, 0x10);
 
 	b = _wire->reset();
-	return (b == 1);
+	return (b == 1) && r == ONEWIRE_READ_OK;
 }
 
 void DallasTemperature::writeScratchPad(const uint8_t* deviceAddress,
@@ -438,8 +473,11 @@ void DallasTemperature::blockTillConversionComplete(uint8_t bitResolution) {
 
   if (checkForConversion && !parasite) {
     unsigned long start = millis();
-    while (!isConversionComplete() && (millis() - start < MAX_CONVERSION_TIMEOUT ))
+    bool done;
+    while (!(done = isConversionComplete()) && (millis() - start < MAX_CONVERSION_TIMEOUT ))
       yield();
+    if (!done)
+      stats.conversionTimeouts++;
   } else {
     unsigned long delms = millisToWaitForConversion(bitResolution);
     activateExternalPullup();
@@ -645,8 +683,14 @@ int16_t DallasTemperature::calculateTemperature(const uint8_t* deviceAddress,
 int16_t DallasTemperature::getTemp(const uint8_t* deviceAddress) {
 
 	ScratchPad scratchPad;
-	if (isConnected(deviceAddress, scratchPad))
-		return calculateTemperature(deviceAddress, scratchPad);
+	for (uint8_t retries = 0; ; retries++) {
+		if (isConnected(deviceAddress, scratchPad))
+			return calculateTemperature(deviceAddress, scratchPad);
+		if (retries == DALLAS_READ_RETRIES)
+			break;
+		stats.readRetries++;
+	}
+	stats.readErrors++;
 	return DEVICE_DISCONNECTED_RAW;
 
 }
@@ -674,6 +718,28 @@ bool DallasTemperature::isParasitePowerMode(void) {
 	return parasite;
 }
 
+void DallasTemperature::clearStats(void) {
+	stats.readRetries = 0;
+	stats.readErrors = 0;
+	stats.conversionTimeouts = 0;
+}
+
+// one line for this class, one for the bus, e.g.
+// "ds18 retries 2 errors 0 timeouts 0"
+// "1-wire resets 310 no presence 0 crc 2 zeros 0 header 0"
+void DallasTemperature::printStats(Print& out) {
+	out.print(F("ds18 retries "));
+	out.print(stats.readRetries);
+	out.print(F(" errors "));
+	out.print(stats.readErrors);
+	out.print(F(" timeouts "));
+	out.println(stats.conversionTimeouts);
+#if ONEWIRE_STATS
+	out.print(F("1-wire "));
+	_wire->stats.print(out);
+#endif
+}
+
 // IF alarm is not used one can store a 16 bit int of userdata in the alarm
 // registers. E.g. an ID of the sensor.
 // See github issue #29
@@ -18,6 +18,11 @@
 #define REQUIRESALARMS true
 #endif
 
+// number of times getTemp() reads the scratchpad again after a bad read
+#ifndef DALLAS_READ_RETRIES
+#define DALLAS_READ_RETRIES 1
+#endif
+
 #include <inttypes.h>
 #ifdef __STM32F1__
 #include <OneWireSTM.h>
@@ -58,6 +63,16 @@ public:
 	// initialise bus
 	void begin(void);
 
+	// counts a device found by a search of the bus and takes its power
+	// mode and resolution into account, as begin() does for every device;
+	// returns true for a supported temperature sensor
+	bool addDevice(const uint8_t*);
+
+	// adds a device remembered from an earlier search, with its resolution
+	// and power mode, without searching the bus; one scratchpad read checks
+	// that it is still there and returns false if it is not
+	bool addCachedDevice(const uint8_t*, uint8_t, bool);
+
 	// returns the number of devices found on the bus
 	uint8_t getDeviceCount(void);
 
@@ -80,7 +95,7 @@ public:
 	// also allows for updating the read scratchpad
 	bool isConnected(const uint8_t*, uint8_t*);
 
-	// read device's scratchpad
+	// read device's scratchpad, returns true if it was read with a good CRC
 	bool readScratchPad(const uint8_t*, uint8_t*);
 
 	// write device's scratchpad
@@ -122,6 +137,10 @@ public:
 	// returns temperature raw value (12 bit integer of 1/128 degrees C)
 	int16_t getTemp(const uint8_t*);
 
+	// converts a scratchpad read by other means (e.g. OneWireAsync) to the
+	// raw temperature, 1/128 degrees C
+	static int16_t calculateTemperature(const uint8_t*, uint8_t*);
+
 	// returns temperature in degrees C
 	float getTempC(const uint8_t*);
 
@@ -137,6 +156,19 @@ public:
 	// returns true if the bus requires parasite power
 	bool isParasitePowerMode(void);
 
+	// health counters, for telling apart why readings fail
+	struct Stats {
+		uint16_t readRetries;        // scratchpad reads repeated after an error
+		uint16_t readErrors;         // getTemp() results of DEVICE_DISCONNECTED
+		uint16_t conversionTimeouts; // conversions not finished in time, or not done
+	} stats;
+
+	// clears the counters above, not those of the OneWire bus
+	void clearStats(void);
+
+	// prints the counters above and those of the OneWire bus
+	void printStats(Print&);
+
 	// Is a conversion complete on the wire? Only applies to the first sensor on the wire.
 	bool isConversionComplete(void);
 
@@ -271,8 +303,6 @@ private:
 	// Take a pointer to one wire instance
 	OneWire* _wire;
 
-	// reads scratchpad and returns the raw temperature
-	int16_t calculateTemperature(const uint8_t*, uint8_t*);
 
 	void blockTillConversionComplete(uint8_t);
 
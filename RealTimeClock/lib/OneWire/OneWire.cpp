@@ -142,13 +142,149 @@ sample code bearing this copyright.
 #include <Arduino.h>
 #include "OneWire.h"
 #include "util/OneWire_direct_gpio.h"
+#if ONEWIRE_UART
+#include "util/OneWire_uart.h"
+#endif
+
+// bump one of the bus health counters
+#if ONEWIRE_STATS
+#define COUNT(counter) (stats.counter++)
+#else
+#define COUNT(counter)
+#endif
+
 
+#if ONEWIRE_UART
+
+void OneWire::begin(uint8_t pin)
+{
+	(void)pin;
+	onewire_uart_begin();
+#if ONEWIRE_SEARCH
+	reset_search();
+#endif
+}
+
+// Reset at 9600 baud: 0xF0 holds the line low for 520uS, and a presence
+// pulse after that pulls down some of the upper bits read back.
+//
+// Returns 1 if a device asserted a presence pulse, 0 otherwise.
+//
+uint8_t OneWire::reset(void)
+{
+	COUNT(resets);
+	onewire_uart_baud(true);
+	uint8_t r = onewire_uart_touch(0xF0);
+	onewire_uart_baud(false);
+	// 0x00 is a shorted bus, 0xF0 no device
+	if (r == 0xF0 || r == 0x00) {
+		COUNT(noPresence);
+		return 0;
+	}
+	return 1;
+}
+
+void OneWire::write_bit(uint8_t v)
+{
+	onewire_uart_touch((v & 1) ? 0xFF : 0x00);
+}
+
+uint8_t OneWire::read_bit(void)
+{
+	return onewire_uart_touch(0xFF) == 0xFF;
+}
+
+void OneWire::write(uint8_t v, uint8_t power /* = 0 */) {
+    uint8_t bitMask;
+
+    (void)power;   // the USART cannot drive the bus high
+    for (bitMask = 0x01; bitMask; bitMask <<= 1) {
+	OneWire::write_bit( (bitMask & v)?1:0);
+    }
+}
+
+void OneWire::write_bytes(const uint8_t *buf, uint16_t count, bool power /* = 0 */) {
+  for (uint16_t i = 0 ; i < count ; i++)
+    write(buf[i], power);
+}
+
+void OneWire::depower()
+{
+}
+
+#else
+
+// Interrupts are only disabled where a delay would corrupt a slot, and
+// for the read-modify-write of the port registers.  Cycles with
+// interrupts disabled, standard speed, ATmega328 at 16MHz:
+//
+//   write 1:   cli, low, output, delay 6uS, high, sei        113   7.1uS
+//   read:      cli, output, low, delay 3uS, input,
+//              delay 8uS, sample, sei                        197  12.3uS
+//   write 0:   cli, low, output, sei; later cli, high, sei    12   0.8uS
+//   reset:     cli, input, sei; cli, low, output, sei         12   0.8uS
+//   unpowered: end of write_bytes(), cli, input, low, sei     12   0.8uS
+//   depower:   cli, input, sei                                 7   0.4uS
+//
+// counted from the AVR instruction timings: each DIRECT_xxx port update
+// is ldd/and-or/std on Z, 5 cycles, a sample 4, cli and sei 1 each, and
+// delayMicroseconds(n) of the Arduino AVR core takes n * 16 cycles within
+// 2, call included.  A pending interrupt runs one instruction after sei.
+// That is the worst-case latency the bit-banged bus adds to other
+// interrupts; it used to be 65uS for every 0 bit and 70uS per reset.
+// An interrupt handler running during the 60uS low time of a 0 bit only
+// stretches it (the limit is 120uS), and the presence pulse is polled
+// with interrupts enabled.
+//
+// These are counts, not measurements: no disassembly of a build or
+// scope trace went into them, and a compiler that keeps the mask in
+// memory instead of a register adds a few cycles per port update.  To
+// measure them on a board, define ONEWIRE_IRQ_PROBE_PIN as a spare pin
+// and watch it on a scope or logic analyser; it is high while
+// interrupts are disabled (its own port writes add a few cycles).
+
+#ifdef ONEWIRE_IRQ_PROBE_PIN
+static volatile IO_REG_TYPE *irqProbeReg;
+static IO_REG_TYPE irqProbeMask;
+#define IRQ_OFF() do { noInterrupts(); DIRECT_WRITE_HIGH(irqProbeReg, irqProbeMask); } while (0)
+#define IRQ_ON()  do { DIRECT_WRITE_LOW(irqProbeReg, irqProbeMask); interrupts(); } while (0)
+#else
+#define IRQ_OFF() noInterrupts()
+#define IRQ_ON()  interrupts()
+#endif
+
+#if ONEWIRE_OVERDRIVE
+// Overdrive slot timings from Maxim AN126, in microseconds.  The
+// delayMicroseconds() granularity is 1uS, so minimum times are rounded
+// up and sample points down.  A whole overdrive slot is shorter than
+// the atomic part of a standard one, so each slot runs with interrupts
+// disabled; an overdrive reset adds an 80uS window.
+#define OD_RESET_LOW     70  // H
+#define OD_RESET_SAMPLE  8   // I  8.5
+#define OD_RESET_REST    40  // J
+#define OD_WRITE1_LOW    1   // A
+#define OD_WRITE1_REST   8   // B  7.5
+#define OD_WRITE0_LOW    8   // C  7.5
+#define OD_WRITE0_REST   3   // D  2.5
+#define OD_READ_LOW      1   // A
+#define OD_READ_SAMPLE   1   // E
+#define OD_READ_REST     7   // F
+#endif
 
 void OneWire::begin(uint8_t pin)
 {
 	pinMode(pin, INPUT);
 	bitmask = PIN_TO_BITMASK(pin);
 	baseReg = PIN_TO_BASEREG(pin);
+#if ONEWIRE_OVERDRIVE
+	overdrive = false;
+#endif
+#ifdef ONEWIRE_IRQ_PROBE_PIN
+	pinMode(ONEWIRE_IRQ_PROBE_PIN, OUTPUT);
+	irqProbeMask = PIN_TO_BITMASK(ONEWIRE_IRQ_PROBE_PIN);
+	irqProbeReg = PIN_TO_BASEREG(ONEWIRE_IRQ_PROBE_PIN);
+	DIRECT_WRITE_LOW(irqProbeReg, irqProbeMask);
+#endif
 #if ONEWIRE_SEARCH
 	reset_search();
 #endif
@@ -168,28 +304,72 @@ uint8_t OneWire::reset(void)
 	uint8_t r;
 	uint8_t retries = 125;
 
-	noInterrupts();
+	COUNT(resets);
+	IRQ_OFF();
 	DIRECT_MODE_INPUT(reg, mask);
-	interrupts();
+	IRQ_ON();
 	// wait until the wire is high... just in case
 	do {
-		if (--retries == 0) return 0;
+		if (--retries == 0) {
+			COUNT(noPresence);
+			return 0;
+		}
 		delayMicroseconds(2);
 	} while ( !DIRECT_READ(reg, mask));
 
-	noInterrupts();
+#if ONEWIRE_OVERDRIVE
+	if (overdrive) {
+		if (reset_overdrive()) return 1;
+		// nobody answered at overdrive speed, fall back to standard
+		overdrive = false;
+	}
+#endif
+
+	IRQ_OFF();
 	DIRECT_WRITE_LOW(reg, mask);
 	DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
-	interrupts();
+	IRQ_ON();
 	delayMicroseconds(480);
-	noInterrupts();
+	IRQ_OFF();
+	DIRECT_MODE_INPUT(reg, mask);	// allow it to float
+	IRQ_ON();
+	// The presence pulse starts 15-60uS after release and lasts at least
+	// 60uS.  Sampling every 10uS from 15uS to 235uS sees it even when an
+	// interrupt handler delays a few samples.  Nothing is sampled before
+	// 15uS (tPDH min): a long cable may still be rising then, and would
+	// read as a presence on an empty bus.
+	r = 0;
+	delayMicroseconds(15);
+	for (uint8_t i = 0; i < 23; i++) {
+		if (!DIRECT_READ(reg, mask)) r = 1;
+		delayMicroseconds(10);
+	}
+	delayMicroseconds(235);
+	if (!r) COUNT(noPresence);
+	return r;
+}
+
+#if ONEWIRE_OVERDRIVE
+// Overdrive reset, only answered by devices already at overdrive speed.
+// Returns 1 if a device asserted a presence pulse, 0 otherwise.
+uint8_t OneWire::reset_overdrive(void)
+{
+	IO_REG_TYPE mask IO_REG_MASK_ATTR = bitmask;
+	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
+	uint8_t r;
+
+	IRQ_OFF();
+	DIRECT_WRITE_LOW(reg, mask);
+	DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
+	delayMicroseconds(OD_RESET_LOW);
 	DIRECT_MODE_INPUT(reg, mask);	// allow it to float
-	delayMicroseconds(70);
+	delayMicroseconds(OD_RESET_SAMPLE);
 	r = !DIRECT_READ(reg, mask);
-	interrupts();
-	delayMicroseconds(410);
+	IRQ_ON();
+	delayMicroseconds(OD_RESET_REST);
 	return r;
 }
+#endif
 
 //
 // Write a bit. Port and bit is used to cut lookup time and provide
@@ -200,22 +380,37 @@ void OneWire::write_bit(uint8_t v)
 	IO_REG_TYPE mask IO_REG_MASK_ATTR = bitmask;
 	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
 
+#if ONEWIRE_OVERDRIVE
+	if (overdrive) {
+		IRQ_OFF();
+		DIRECT_WRITE_LOW(reg, mask);
+		DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
+		delayMicroseconds((v & 1) ? OD_WRITE1_LOW : OD_WRITE0_LOW);
+		DIRECT_WRITE_HIGH(reg, mask);	// drive output high
+		IRQ_ON();
+		delayMicroseconds((v & 1) ? OD_WRITE1_REST : OD_WRITE0_REST);
+		return;
+	}
+#endif
+
 	if (v & 1) {
-		noInterrupts();
+		IRQ_OFF();
 		DIRECT_WRITE_LOW(reg, mask);
 		DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
-		delayMicroseconds(10);
+		delayMicroseconds(6);
 		DIRECT_WRITE_HIGH(reg, mask);	// drive output high
-		interrupts();
-		delayMicroseconds(55);
+		IRQ_ON();
+		delayMicroseconds(64);
 	} else {
-		noInterrupts();
+		IRQ_OFF();
 		DIRECT_WRITE_LOW(reg, mask);
 		DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
-		delayMicroseconds(65);
+		IRQ_ON();
+		delayMicroseconds(60);		// interrupts may stretch this
+		IRQ_OFF();
 		DIRECT_WRITE_HIGH(reg, mask);	// drive output high
-		interrupts();
-		delayMicroseconds(5);
+		IRQ_ON();
+		delayMicroseconds(10);
 	}
 }
 
@@ -229,15 +424,30 @@ uint8_t OneWire::read_bit(void)
 	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
 	uint8_t r;
 
-	noInterrupts();
+#if ONEWIRE_OVERDRIVE
+	if (overdrive) {
+		IRQ_OFF();
+		DIRECT_MODE_OUTPUT(reg, mask);
+		DIRECT_WRITE_LOW(reg, mask);
+		delayMicroseconds(OD_READ_LOW);
+		DIRECT_MODE_INPUT(reg, mask);	// let pin float, pull up will raise
+		delayMicroseconds(OD_READ_SAMPLE);
+		r = DIRECT_READ(reg, mask);
+		IRQ_ON();
+		delayMicroseconds(OD_READ_REST);
+		return r;
+	}
+#endif
+
+	IRQ_OFF();
 	DIRECT_MODE_OUTPUT(reg, mask);
 	DIRECT_WRITE_LOW(reg, mask);
 	delayMicroseconds(3);
 	DIRECT_MODE_INPUT(reg, mask);	// let pin float, pull up will raise
-	delayMicroseconds(10);
+	delayMicroseconds(8);
 	r = DIRECT_READ(reg, mask);
-	interrupts();
-	delayMicroseconds(53);
+	IRQ_ON();
+	delayMicroseconds(55);
 	return r;
 }
 
@@ -255,10 +465,10 @@ void OneWire::write(uint8_t v, uint8_t power /* = 0 */) {
 	OneWire::write_bit( (bitMask & v)?1:0);
     }
     if ( !power) {
-	noInterrupts();
+	IRQ_OFF();
 	DIRECT_MODE_INPUT(baseReg, bitmask);
 	DIRECT_WRITE_LOW(baseReg, bitmask);
-	interrupts();
+	IRQ_ON();
     }
 }
 
@@ -266,12 +476,13 @@ void OneWire::write_bytes(const uint8_t *buf, uint16_t count, bool power /* = 0
   for (uint16_t i = 0 ; i < count ; i++)
     write(buf[i]);
   if (!power) {
-    noInterrupts();
+    IRQ_OFF();
     DIRECT_MODE_INPUT(baseReg, bitmask);
     DIRECT_WRITE_LOW(baseReg, bitmask);
-    interrupts();
+    IRQ_ON();
   }
 }
+#endif
 
 //
 // Read a byte
@@ -311,12 +522,49 @@ void OneWire::skip()
     write(0xCC);           // Skip ROM
 }
 
+#if ONEWIRE_OVERDRIVE
+//
+// Overdrive ROM skip and select.  The command goes out at standard speed,
+// everything after it at overdrive speed.
+//
+void OneWire::overdrive_skip()
+{
+    write(0x3C);           // Overdrive Skip ROM
+    overdrive = true;
+}
+
+void OneWire::overdrive_select(const uint8_t rom[8])
+{
+    uint8_t i;
+
+    write(0x69);           // Overdrive Match ROM
+    overdrive = true;
+    for (i = 0; i < 8; i++) write(rom[i]);
+}
+
+bool OneWire::overdrive_capable(const uint8_t rom[8])
+{
+    bool capable = false;
+
+    overdrive = false;
+    if (reset()) {
+        overdrive_select(rom);
+        capable = reset_overdrive();
+    }
+    overdrive = false;
+    reset();               // everyone back to standard speed
+    return capable;
+}
+#endif
+
+#if !ONEWIRE_UART
 void OneWire::depower()
 {
-	noInterrupts();
+	IRQ_OFF();
 	DIRECT_MODE_INPUT(baseReg, bitmask);
-	interrupts();
+	IRQ_ON();
 }
+#endif
 
 #if ONEWIRE_SEARCH
 
@@ -500,46 +748,75 @@ static const uint8_t PROGMEM dscrc2x16_table[] = {
 	0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74
 };
 
-// Compute a Dallas Semiconductor 8 bit CRC. These show up in the ROM
-// and the registers.  (Use tiny 2x16 entry CRC table)
-uint8_t OneWire::crc8(const uint8_t *addr, uint8_t len)
+// Add one byte to a Dallas Semiconductor 8 bit CRC. These show up in
+// the ROM and the registers.  (Use tiny 2x16 entry CRC table)
+uint8_t OneWire::crc8_update(uint8_t crc, uint8_t data)
 {
-	uint8_t crc = 0;
-
-	while (len--) {
-		crc = *addr++ ^ crc;  // just re-using crc as intermediate
-		crc = pgm_read_byte(dscrc2x16_table + (crc & 0x0f)) ^
+	crc = data ^ crc;  // just re-using crc as intermediate
+	return pgm_read_byte(dscrc2x16_table + (crc & 0x0f)) ^
 		pgm_read_byte(dscrc2x16_table + 16 + ((crc >> 4) & 0x0f));
-	}
-
-	return crc;
 }
 #else
 //
 // Compute a Dallas Semiconductor 8 bit CRC directly.
 // this is much slower, but a little smaller, than the lookup table.
 //
-uint8_t OneWire::crc8(const uint8_t *addr, uint8_t len)
+uint8_t OneWire::crc8_update(uint8_t crc, uint8_t data)
 {
-	uint8_t crc = 0;
-
-	while (len--) {
 #if defined(__AVR__)
-		crc = _crc_ibutton_update(crc, *addr++);
+	return _crc_ibutton_update(crc, data);
 #else
-		uint8_t inbyte = *addr++;
-		for (uint8_t i = 8; i; i--) {
-			uint8_t mix = (crc ^ inbyte) & 0x01;
-			crc >>= 1;
-			if (mix) crc ^= 0x8C;
-			inbyte >>= 1;
-		}
-#endif
+	for (uint8_t i = 8; i; i--) {
+		uint8_t mix = (crc ^ data) & 0x01;
+		crc >>= 1;
+		if (mix) crc ^= 0x8C;
+		data >>= 1;
 	}
 	return crc;
+#endif
 }
 #endif
 
+uint8_t OneWire::crc8(const uint8_t *addr, uint8_t len)
+{
+	uint8_t crc = 0;
+
+	while (len--)
+		crc = crc8_update(crc, *addr++);
+	return crc;
+}
+
+// One pass over the incoming bytes: CRC, zero test and header check are
+// done while the bus is idle between two bytes, so no second loop over
+// 'buf' is needed afterwards.
+uint8_t OneWire::read_bytes_crc8(uint8_t *buf, uint8_t count,
+	uint8_t check /* = 0 */, uint8_t mask /* = 0 */, uint8_t value /* = 0 */)
+{
+	uint8_t crc = 0;
+	uint8_t any = 0;
+
+	for (uint8_t i = 0; i < count; i++) {
+		uint8_t b = read();
+		buf[i] = b;
+		if (mask && i == check && (b & mask) != value) {
+			COUNT(headerErrors);
+			return ONEWIRE_READ_HEADER;
+		}
+		any |= b;
+		crc = crc8_update(crc, b);
+	}
+	if (!any) {
+		COUNT(zeroReads);
+		return ONEWIRE_READ_ZEROS;
+	}
+	// the CRC of the data followed by its CRC is 0
+	if (crc) {
+		COUNT(crcErrors);
+		return ONEWIRE_READ_CRC;
+	}
+	return ONEWIRE_READ_OK;
+}
+
 #if ONEWIRE_CRC16
 bool OneWire::check_crc16(const uint8_t* input, uint16_t len, const uint8_t* inverted_crc, uint16_t crc)
 {
@@ -549,32 +826,97 @@ bool OneWire::check_crc16(const uint8_t* input, uint16_t len, const uint8_t* inv
 
 uint16_t OneWire::crc16(const uint8_t* input, uint16_t len, uint16_t crc)
 {
-#if defined(__AVR__)
     for (uint16_t i = 0 ; i < len ; i++) {
-        crc = _crc16_update(crc, input[i]);
+        crc = crc16_update(crc, input[i]);
     }
+    return crc;
+}
+
+uint16_t OneWire::crc16_update(uint16_t crc, uint8_t data)
+{
+#if defined(__AVR__)
+    return _crc16_update(crc, data);
 #else
     static const uint8_t oddparity[16] =
         { 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0 };
 
-    for (uint16_t i = 0 ; i < len ; i++) {
-      // Even though we're just copying a byte from the input,
-      // we'll be doing 16-bit computation with it.
-      uint16_t cdata = input[i];
-      cdata = (cdata ^ crc) & 0xff;
-      crc >>= 8;
-
-      if (oddparity[cdata & 0x0F] ^ oddparity[cdata >> 4])
-          crc ^= 0xC001;
-
-      cdata <<= 6;
-      crc ^= cdata;
-      cdata <<= 1;
-      crc ^= cdata;
-    }
-#endif
+    // Even though we're just copying a byte from the input,
+    // we'll be doing 16-bit computation with it.
+    uint16_t cdata = data;
+    cdata = (cdata ^ crc) & 0xff;
+    crc >>= 8;
+
+    if (oddparity[cdata & 0x0F] ^ oddparity[cdata >> 4])
+        crc ^= 0xC001;
+
+    cdata <<= 6;
+    crc ^= cdata;
+    cdata <<= 1;
+    crc ^= cdata;
     return crc;
+#endif
+}
+
+uint8_t OneWire::read_bytes_crc16(uint8_t *buf, uint16_t count, uint16_t crc /* = 0 */)
+{
+    uint8_t any = 0;
+
+    for (uint16_t i = 0 ; i < count ; i++) {
+        uint8_t b = read();
+        buf[i] = b;
+        any |= b;
+        crc = crc16_update(crc, b);
+    }
+    if (!any) {
+        COUNT(zeroReads);
+        return ONEWIRE_READ_ZEROS;
+    }
+    // the CRC over the data and its inverted CRC is always 0xB001
+    if (crc != 0xB001) {
+        COUNT(crcErrors);
+        return ONEWIRE_READ_CRC;
+    }
+    return ONEWIRE_READ_OK;
 }
 #endif
 
 #endif
+
+#if ONEWIRE_STATS
+void OneWireStats::clear(void)
+{
+	resets = 0;
+	noPresence = 0;
+	crcErrors = 0;
+	zeroReads = 0;
+	headerErrors = 0;
+}
+
+void OneWireStats::count_read(uint8_t result)
+{
+	switch (result) {
+	case ONEWIRE_READ_CRC:    crcErrors++; break;
+	case ONEWIRE_READ_ZEROS:  zeroReads++; break;
+	case ONEWIRE_READ_HEADER: headerErrors++; break;
+	}
+}
+
+void OneWireStats::print(Print &out) const
+{
+	// OneWireAsync counts from its interrupt handler
+	noInterrupts();
+	OneWireStats s = *this;
+	interrupts();
+
+	out.print(F("resets "));
+	out.print(s.resets);
+	out.print(F(" no presence "));
+	out.print(s.noPresence);
+	out.print(F(" crc "));
+	out.print(s.crcErrors);
+	out.print(F(" zeros "));
+	out.print(s.zeroReads);
+	out.print(F(" header "));
+	out.println(s.headerErrors);
+}
+#endif
@@ -51,7 +51,71 @@
 #define ONEWIRE_CRC16 1
 #endif
 
-// Board-specific macros for direct GPIO
+// Run the bus on the AVR USART instead of a GPIO pin by defining this
+// to 1 (see util/OneWire_uart.h for the wiring).  The pin passed to
+// begin() is then ignored.  All bit timing is done by the USART, with
+// no busy delays and no interrupts disabled.
+#ifndef ONEWIRE_UART
+#define ONEWIRE_UART 0
+#endif
+
+// Host builds only: define this to 1 to run the bus on the simulated
+// devices of OneWireVirtual.h instead of a pin, so the bit engine and
+// the code above it can be exercised and timed without hardware.
+#ifndef ONEWIRE_VIRTUAL_BUS
+#define ONEWIRE_VIRTUAL_BUS 0
+#endif
+#if ONEWIRE_VIRTUAL_BUS && ONEWIRE_UART
+#error "ONEWIRE_VIRTUAL_BUS replaces the pin, it cannot be used with ONEWIRE_UART"
+#endif
+
+// You can exclude overdrive speed support by defining this to 0.  It is
+// not available with ONEWIRE_UART, or in OneWireAsync.
+#ifndef ONEWIRE_OVERDRIVE
+#define ONEWIRE_OVERDRIVE 1
+#endif
+#if ONEWIRE_UART
+#undef ONEWIRE_OVERDRIVE
+#define ONEWIRE_OVERDRIVE 0
+#endif
+
+// read_bytes_crc8() and read_bytes_crc16() results
+#define ONEWIRE_READ_OK     0
+#define ONEWIRE_READ_CRC    1 // CRC mismatch
+#define ONEWIRE_READ_ZEROS  2 // every byte was 0, the bus is held low
+#define ONEWIRE_READ_HEADER 3 // stopped at the byte that failed the check
+
+// You can exclude the bus health counters (OneWire::stats) by defining
+// this to 0.  They take 10 bytes of RAM per bus.
+#ifndef ONEWIRE_STATS
+#define ONEWIRE_STATS 1
+#endif
+
+#if ONEWIRE_STATS
+// Bus health counters, kept by OneWire and OneWireAsync.  They count up
+// from 0 and wrap around after 65535; clear() starts over.
+struct OneWireStats
+{
+    uint16_t resets;       // reset pulses sent
+    uint16_t noPresence;   // resets without a presence pulse, or bus shorted
+    uint16_t crcErrors;    // reads with a bad CRC
+    uint16_t zeroReads;    // reads that were all zeros, bus held low
+    uint16_t headerErrors; // reads stopped by the header check
+
+    OneWireStats() { clear(); }
+    void clear(void);
+
+    // Count one ONEWIRE_READ_xxx result, for checks done by the caller
+    void count_read(uint8_t result);
+
+    // Print the counters on one line, e.g. to Serial
+    void print(Print &out) const;
+};
+#endif
+
+// Board-specific macros for direct GPIO.  OneWireMulti.h undefines
+// IO_REG_TYPE after use as well, so the header may have to be read again.
+#undef OneWire_Direct_RegType_h
 #include "util/OneWire_direct_regtype.h"
 
 class OneWire
@@ -60,6 +124,11 @@ class OneWire
     IO_REG_TYPE bitmask;
     volatile IO_REG_TYPE *baseReg;
 
+#if ONEWIRE_OVERDRIVE
+    bool overdrive;
+    uint8_t reset_overdrive(void);
+#endif
+
 #if ONEWIRE_SEARCH
     // global search state
     unsigned char ROM_NO[8];
@@ -69,6 +138,10 @@ class OneWire
 #endif
 
   public:
+#if ONEWIRE_STATS
+    OneWireStats stats;
+#endif
+
     OneWire() { }
     OneWire(uint8_t pin) { begin(pin); }
     void begin(uint8_t pin);
@@ -84,6 +157,31 @@ class OneWire
     // Issue a 1-Wire rom skip command, to address all on bus.
     void skip(void);
 
+#if ONEWIRE_OVERDRIVE
+    // Overdrive Skip ROM (0x3C): every device that supports overdrive
+    // switches to it, the others drop off until the next standard reset.
+    // From here on reset(), read and write run at overdrive speed, about
+    // 8-10 times faster, so search() only finds the overdrive devices.
+    // You do the reset first.
+    void overdrive_skip(void);
+
+    // Overdrive Match ROM (0x69): like select(), but the ROM is sent and
+    // the selected device then talks at overdrive speed.
+    void overdrive_select(const uint8_t rom[8]);
+
+    // Returns true if the device answers an overdrive reset after an
+    // overdrive match.  All devices are back at standard speed after.
+    bool overdrive_capable(const uint8_t rom[8]);
+
+    // If an overdrive reset finds no device, reset() falls back to a
+    // standard reset, which also returns every device to standard speed,
+    // and the bus stays at standard speed.  overdrive_active() tells
+    // which speed is in use; overdrive_end() makes the next reset() a
+    // standard one.
+    bool overdrive_active(void) const { return overdrive; }
+    void overdrive_end(void) { overdrive = false; }
+#endif
+
     // Write a byte. If 'power' is one then the wire is held high at
     // the end for parasitically powered devices. You are responsible
     // for eventually depowering it by calling depower() or doing
@@ -133,6 +231,22 @@ class OneWire
     // ROM and scratchpad registers.
     static uint8_t crc8(const uint8_t *addr, uint8_t len);
 
+    // Add one byte to an 8 bit CRC
+    static uint8_t crc8_update(uint8_t crc, uint8_t data);
+
+    // Read 'count' bytes, the last one being the CRC8 of the others, and
+    // check them as they arrive, in the gaps between the bit slots.
+    // Returns ONEWIRE_READ_OK, ONEWIRE_READ_CRC, or ONEWIRE_READ_ZEROS when
+    // all bytes are 0 (which has a good CRC).  If 'mask' is not 0, byte
+    // number 'check' must have (byte & mask) == value, otherwise the read
+    // stops right there with ONEWIRE_READ_HEADER and the rest of 'buf' is
+    // not filled in; reset() the bus before the next command.
+    // Example (DS18B20 scratchpad, configuration bit 7 is always 0):
+    //    ds.write(0xBE);
+    //    if (ds.read_bytes_crc8(buf, 9, 4, 0x80, 0x00) == ONEWIRE_READ_OK) ...
+    uint8_t read_bytes_crc8(uint8_t *buf, uint8_t count,
+        uint8_t check = 0, uint8_t mask = 0, uint8_t value = 0);
+
 #if ONEWIRE_CRC16
     // Compute the 1-Wire CRC16 and compare it against the received CRC.
     // Example usage (reading a DS2408):
@@ -169,6 +283,16 @@ class OneWire
     // @param crc - The crc starting value (optional)
     // @return The CRC16, as defined by Dallas Semiconductor.
     static uint16_t crc16(const uint8_t* input, uint16_t len, uint16_t crc = 0);
+
+    // Add one byte to a 16 bit CRC
+    static uint16_t crc16_update(uint16_t crc, uint8_t data);
+
+    // Read 'count' bytes ending with the two inverted CRC16 bytes and
+    // check them as they arrive.  'crc' is the CRC16 of what the device
+    // includes before the data, usually the command bytes that were
+    // written.  Returns ONEWIRE_READ_OK, ONEWIRE_READ_CRC or
+    // ONEWIRE_READ_ZEROS.
+    uint8_t read_bytes_crc16(uint8_t *buf, uint16_t count, uint16_t crc = 0);
 #endif
 #endif
 };
@@ -0,0 +1,372 @@
+// Interrupt driven 1-Wire transport, see OneWireAsync.h
+//
+// Bit slot timing is the same as OneWire.cpp.  Each interrupt performs
+// the time-critical start of a slot and then programs the next compare
+// for the point where the bus needs attention again:
+//
+//   write 1:  low 6uS, high                     -> next in 64uS
+//   read:     low 3uS, release, sample at 11uS  -> next in 55uS
+//   write 0:  low                               -> next in 65uS,
+//             high, 5uS recovery, then the following slot right away
+//   reset:    low                               -> next in 480uS,
+//             release                           -> next in 65uS,
+//             sample presence                   -> next in 415uS
+//
+// The presence pulse is only certain to be there 60-75uS after release,
+// so it is sampled early in that window to leave room for the latency of
+// other interrupt handlers.
+//
+// With ONEWIRE_UART each slot is one USART frame instead (see
+// util/OneWire_uart.h) and the RX complete interrupt sends the next one.
+
+#include <Arduino.h>
+#include "OneWireAsync.h"
+#include "util/OneWire_direct_gpio.h"
+#if ONEWIRE_UART
+#include "util/OneWire_uart.h"
+#endif
+
+#define OP_RESET 0
+#define OP_WRITE 1
+#define OP_WRITE_POWER 2 // leave the bus driven high afterwards
+#define OP_READ 3
+
+// bump one of the bus health counters
+#if ONEWIRE_STATS
+#define COUNT(counter) (stats.counter++)
+#else
+#define COUNT(counter)
+#endif
+
+#if defined(__AVR__) && defined(TIMSK1) && !ONEWIRE_UART
+#define ONEWIRE_ASYNC_TIMER1 1
+#define TICKS_PER_US (F_CPU / 8000000UL) // Timer1 runs at clock/8
+#endif
+
+OneWireAsync * volatile OneWireAsync::active = NULL;
+
+void OneWireAsync::begin(uint8_t pin)
+{
+#if ONEWIRE_UART
+	(void)pin;
+	onewire_uart_begin();
+#else
+	pinMode(pin, INPUT);
+	bitmask = PIN_TO_BITMASK(pin);
+	baseReg = PIN_TO_BASEREG(pin);
+#endif
+}
+
+// Append an operation, starting a new list if the last transaction ended
+OneWireAsync::Op *OneWireAsync::queue(uint8_t kind, uint8_t n)
+{
+	if (state == ONEWIRE_ASYNC_BUSY) return NULL;
+	if (state != ONEWIRE_ASYNC_IDLE) {
+		if (state == ONEWIRE_ASYNC_OVERFLOW) return NULL;
+		count = 0;
+		state = ONEWIRE_ASYNC_IDLE;
+	}
+	if (count == ONEWIRE_ASYNC_OPS) {
+		state = ONEWIRE_ASYNC_OVERFLOW;
+		return NULL;
+	}
+	Op *op = &ops[count++];
+	op->kind = kind;
+	op->count = n;
+	op->buf = NULL;
+	return op;
+}
+
+void OneWireAsync::reset(void)
+{
+	queue(OP_RESET, 0);
+}
+
+void OneWireAsync::select(const uint8_t rom[8])
+{
+	write(0x55);           // Choose ROM
+	write_bytes(rom, 8);
+}
+
+void OneWireAsync::skip(void)
+{
+	write(0xCC);           // Skip ROM
+}
+
+void OneWireAsync::write(uint8_t v, uint8_t power /* = 0 */)
+{
+	Op *op = queue(power ? OP_WRITE_POWER : OP_WRITE, 1);
+	if (op) op->value = v;
+}
+
+void OneWireAsync::write_bytes(const uint8_t *buf, uint8_t n, bool power /* = 0 */)
+{
+	Op *op = queue(power ? OP_WRITE_POWER : OP_WRITE, n);
+	if (op) op->buf = (uint8_t *)buf;
+}
+
+void OneWireAsync::read_bytes(uint8_t *buf, uint8_t n)
+{
+	Op *op = queue(OP_READ, n);
+	if (op) op->buf = buf;
+}
+
+bool OneWireAsync::start(Callback done /* = NULL */)
+{
+	if (state == ONEWIRE_ASYNC_OVERFLOW) {
+		// drop the list, the next queue call starts over
+		count = 0;
+		state = ONEWIRE_ASYNC_IDLE;
+		return false;
+	}
+	if (state != ONEWIRE_ASYNC_IDLE || count == 0) return false;
+	noInterrupts();
+	if (active) {
+		interrupts();
+		return false;
+	}
+	active = this;
+	callback = done;
+	current = 0;
+	index = 0;
+	bitMask = 0x01;
+	phase = 0;
+	state = ONEWIRE_ASYNC_BUSY;
+#if ONEWIRE_UART
+	(void)UDR0;                    // drop stale input
+	UCSR0B |= _BV(RXCIE0);
+	uartSend();
+	interrupts();
+#elif ONEWIRE_ASYNC_TIMER1
+	TCCR1A = 0;
+	TCCR1B = _BV(CS11);            // normal mode, clock/8
+	OCR1A = TCNT1 + 20 * TICKS_PER_US;
+	TIFR1 = _BV(OCF1A);
+	TIMSK1 |= _BV(OCIE1A);
+	interrupts();
+#else
+	uint16_t us;
+	while ((us = step()) != 0) {
+		interrupts();
+		delayMicroseconds(us);
+		noInterrupts();
+	}
+	interrupts();
+#endif
+	return true;
+}
+
+uint8_t OneWireAsync::wait(void)
+{
+	while (state == ONEWIRE_ASYNC_BUSY) ;
+	return state;
+}
+
+void OneWireAsync::finish(uint8_t result)
+{
+	active = NULL;
+	state = result;
+	if (callback) callback(result);
+}
+
+#if ONEWIRE_UART
+
+// Send the frame for the slot at the current position, or end the
+// transaction when there is none left.  Called with interrupts disabled.
+void OneWireAsync::uartSend(void)
+{
+	while (current < count) {
+		Op *op = &ops[current];
+		if (op->kind == OP_RESET) {
+			COUNT(resets);
+			onewire_uart_baud(true);
+			UDR0 = 0xF0;
+			return;
+		}
+		if (index == op->count) {
+			current++;
+			index = 0;
+			bitMask = 0x01;
+			continue;
+		}
+		if (op->kind == OP_READ)
+			UDR0 = 0xFF;
+		else
+			UDR0 = ((op->buf ? op->buf[index] : op->value) & bitMask) ? 0xFF : 0x00;
+		return;
+	}
+	UCSR0B &= ~_BV(RXCIE0);
+	finish(ONEWIRE_ASYNC_DONE);
+}
+
+// The frame of the current slot came back, rx is what the bus carried
+void OneWireAsync::uartReceived(uint8_t rx)
+{
+	Op *op = &ops[current];
+	if (op->kind == OP_RESET) {
+		onewire_uart_baud(false);
+		// 0x00 is a shorted bus, 0xF0 no device
+		if (rx == 0xF0 || rx == 0x00) {
+			COUNT(noPresence);
+			UCSR0B &= ~_BV(RXCIE0);
+			finish(ONEWIRE_ASYNC_NO_PRESENCE);
+			return;
+		}
+		current++;
+	} else {
+		if (op->kind == OP_READ) {
+			if (rx == 0xFF)
+				op->buf[index] |= bitMask;
+			else
+				op->buf[index] &= ~bitMask;
+		}
+		bitMask <<= 1;
+		if (!bitMask) {
+			bitMask = 0x01;
+			index++;
+		}
+	}
+	uartSend();
+}
+
+#else
+
+// Run the bus up to the next point that needs attention and return the
+// number of microseconds until then, or 0 once the transaction is over.
+// Called with interrupts disabled.
+uint16_t OneWireAsync::step(void)
+{
+	IO_REG_TYPE mask IO_REG_MASK_ATTR = bitmask;
+	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
+
+	while (current < count) {
+		Op *op = &ops[current];
+
+		if (op->kind == OP_RESET) {
+			switch (phase++) {
+			case 0:
+				// wait up to 250uS for the wire to be high
+				DIRECT_MODE_INPUT(reg, mask);
+				if (!DIRECT_READ(reg, mask)) {
+					if (++index == 25) {
+						COUNT(resets);
+						COUNT(noPresence);
+						finish(ONEWIRE_ASYNC_NO_PRESENCE);
+						return 0;
+					}
+					phase = 0;
+					return 10;
+				}
+				COUNT(resets);
+				DIRECT_WRITE_LOW(reg, mask);
+				DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
+				return 480;
+			case 1:
+				DIRECT_MODE_INPUT(reg, mask);	// allow it to float
+				return 65;
+			case 2:
+				if (DIRECT_READ(reg, mask)) {
+					COUNT(noPresence);
+					finish(ONEWIRE_ASYNC_NO_PRESENCE);
+					return 0;
+				}
+				return 415;
+			}
+			current++;
+			index = 0;
+			phase = 0;
+			continue;
+		}
+
+		if (index == op->count) {
+			if (op->kind == OP_WRITE) {
+				DIRECT_MODE_INPUT(reg, mask);
+				DIRECT_WRITE_LOW(reg, mask);
+			}
+			current++;
+			index = 0;
+			bitMask = 0x01;
+			continue;
+		}
+
+		uint8_t bit = bitMask;
+		uint16_t us;
+		if (op->kind == OP_READ) {
+			DIRECT_MODE_OUTPUT(reg, mask);
+			DIRECT_WRITE_LOW(reg, mask);
+			delayMicroseconds(3);
+			DIRECT_MODE_INPUT(reg, mask);	// let pin float, pull up will raise
+			delayMicroseconds(8);
+			if (DIRECT_READ(reg, mask))
+				op->buf[index] |= bit;
+			else
+				op->buf[index] &= ~bit;
+			us = 55;
+		} else if (phase) {
+			// end of a 0 slot
+			DIRECT_WRITE_HIGH(reg, mask);	// drive output high
+			delayMicroseconds(5);
+			phase = 0;
+			us = 0;
+		} else if ((op->buf ? op->buf[index] : op->value) & bit) {
+			DIRECT_WRITE_LOW(reg, mask);
+			DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
+			delayMicroseconds(6);
+			DIRECT_WRITE_HIGH(reg, mask);	// drive output high
+			us = 64;
+		} else {
+			DIRECT_WRITE_LOW(reg, mask);
+			DIRECT_MODE_OUTPUT(reg, mask);	// drive output low
+			phase = 1;
+			return 65;
+		}
+
+		// next bit
+		bitMask = bit << 1;
+		if (!bitMask) {
+			bitMask = 0x01;
+			index++;
+		}
+		if (us) return us;
+	}
+	finish(ONEWIRE_ASYNC_DONE);
+	return 0;
+}
+
+#endif
+
+void OneWireAsync::onInterrupt(void)
+{
+	OneWireAsync *bus = active;
+#if ONEWIRE_UART
+	uint8_t rx = UDR0;
+	if (bus) bus->uartReceived(rx);
+#else
+	if (!bus) return;
+	uint16_t us = bus->step();
+#if ONEWIRE_ASYNC_TIMER1
+	if (us)
+		OCR1A = TCNT1 + us * TICKS_PER_US;
+	else
+		TIMSK1 &= ~_BV(OCIE1A);
+#else
+	(void)us;
+#endif
+#endif
+}
+
+#if ONEWIRE_UART
+#if defined(USART_RX_vect)
+ISR(USART_RX_vect)
+#else
+ISR(USART0_RX_vect)
+#endif
+{
+	OneWireAsync::onInterrupt();
+}
+#elif ONEWIRE_ASYNC_TIMER1
+ISR(TIMER1_COMPA_vect)
+{
+	OneWireAsync::onInterrupt();
+}
+#endif
@@ -0,0 +1,145 @@
+#ifndef OneWireAsync_h
+#define OneWireAsync_h
+
+#ifdef __cplusplus
+
+#include <stdint.h>
+
+#if ARDUINO >= 100
+#include <Arduino.h>
+#else
+#include "WProgram.h"
+#endif
+
+#include "OneWire.h"       // for the ONEWIRE_xxx options
+
+// Interrupt driven 1-Wire transport.
+//
+// A transaction is a short list of reset, write and read operations that
+// is queued first and then started.  On AVR the bus timing is driven by
+// the Timer1 compare A interrupt, so the caller returns immediately and
+// can keep working while the bus runs in the background.  Only the parts
+// of a bit slot that must be exact (the first 6-11uS) are spent inside
+// the interrupt, the rest of each 65uS slot and the 960uS reset are free
+// for the main program.
+//
+// Timer1 is left running at clock/8 and is not available for analogWrite()
+// on its pins or for the Servo library while this class is in use.  Only
+// one transaction can run at a time, even with several OneWireAsync
+// objects.
+//
+// With ONEWIRE_UART (see OneWire.h) the USART does the bit timing and
+// the RX complete interrupt moves the transaction on by one slot per
+// frame; Timer1 stays free.
+//
+// On other boards start() runs the transaction to completion before it
+// returns.
+//
+//    OneWireAsync bus(2);
+//    uint8_t scratchPad[9];
+//
+//    bus.reset();
+//    bus.select(rom);
+//    bus.write(0xBE);      // read scratchpad
+//    bus.read_bytes(scratchPad, 9);
+//    bus.start();
+//    ...
+//    if (!bus.busy() && bus.status() == ONEWIRE_ASYNC_DONE) ...
+
+// Maximum number of operations in one transaction (select counts as two)
+#ifndef ONEWIRE_ASYNC_OPS
+#define ONEWIRE_ASYNC_OPS 6
+#endif
+
+// Transaction status
+#define ONEWIRE_ASYNC_IDLE        0 // nothing started since the last queue
+#define ONEWIRE_ASYNC_BUSY        1 // the bus is working
+#define ONEWIRE_ASYNC_DONE        2 // finished, read buffers are valid
+#define ONEWIRE_ASYNC_NO_PRESENCE 3 // a reset found no device, or bus shorted
+#define ONEWIRE_ASYNC_OVERFLOW    4 // more than ONEWIRE_ASYNC_OPS were queued
+
+// Board-specific macros for direct GPIO.  OneWire.h undefines
+// IO_REG_TYPE after use, so the header may have to be read again.
+#undef OneWire_Direct_RegType_h
+#include "util/OneWire_direct_regtype.h"
+
+class OneWireAsync
+{
+  public:
+    // Called when a transaction ends, from the timer interrupt on AVR.
+    // Keep it short.
+    typedef void (*Callback)(uint8_t status);
+
+    OneWireAsync() : count(0), state(ONEWIRE_ASYNC_IDLE) { }
+    OneWireAsync(uint8_t pin) : count(0), state(ONEWIRE_ASYNC_IDLE) { begin(pin); }
+    void begin(uint8_t pin);   // pin is ignored with ONEWIRE_UART
+
+    // Queue operations.  The first call after a transaction has ended
+    // starts a new list.  Buffers must stay valid until the transaction
+    // is over.
+    void reset(void);
+    void select(const uint8_t rom[8]);
+    void skip(void);
+    void write(uint8_t v, uint8_t power = 0);
+    void write_bytes(const uint8_t *buf, uint8_t count, bool power = 0);
+    void read_bytes(uint8_t *buf, uint8_t count);
+
+    // Start the queued transaction.  Returns false if the bus is already
+    // in use or nothing was queued.  If the queue overflowed the list is
+    // dropped and false is returned.
+    bool start(Callback done = NULL);
+
+    // Transaction state, one of ONEWIRE_ASYNC_xxx
+    uint8_t status(void) const { return state; }
+    bool busy(void) const { return state == ONEWIRE_ASYNC_BUSY; }
+
+    // Wait for the running transaction to end and return its status
+    uint8_t wait(void);
+
+#if ONEWIRE_STATS
+    // Resets and missing presence pulses; see OneWireStats::count_read()
+    // to add the checks made on the data read
+    OneWireStats stats;
+#endif
+
+    // Timer1 compare or USART RX interrupt entry, not for use by sketches
+    static void onInterrupt(void);
+
+  private:
+    struct Op {
+      uint8_t kind;
+      uint8_t count;
+      uint8_t value;   // byte to write when buf is NULL
+      uint8_t *buf;
+    };
+
+    IO_REG_TYPE bitmask;
+    volatile IO_REG_TYPE *baseReg;
+
+    Op ops[ONEWIRE_ASYNC_OPS];
+    uint8_t count;
+    volatile uint8_t state;
+    Callback callback;
+
+    // position of the interrupt handler in the transaction
+    uint8_t current, index, bitMask, phase;
+
+    static OneWireAsync * volatile active;
+
+    Op *queue(uint8_t kind, uint8_t count);
+#if ONEWIRE_UART
+    void uartSend(void);
+    void uartReceived(uint8_t rx);
+#else
+    uint16_t step(void);
+#endif
+    void finish(uint8_t result);
+};
+
+// Prevent this name from leaking into Arduino sketches
+#ifdef IO_REG_TYPE
+#undef IO_REG_TYPE
+#endif
+
+#endif // __cplusplus
+#endif // OneWireAsync_h
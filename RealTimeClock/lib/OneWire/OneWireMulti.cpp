@@ -0,0 +1,166 @@
+// Several 1-Wire buses on one AVR port, see OneWireMulti.h
+//
+// The slots follow OneWire.cpp, with the port mask of every bus in place
+// of a single pin.  In a write slot all buses go low together and the
+// ones writing a 1 are released after 6uS; a read slot samples the whole
+// port once.  The interrupt-disabled windows are the same as for one bus.
+
+// AVR only, the header stops other boards (see OneWireMulti.h); the
+// library's other files still build there without this one
+#if defined(__AVR__)
+
+#include <Arduino.h>
+#include "OneWireMulti.h"
+#include "util/OneWire_direct_gpio.h"
+
+bool OneWireMulti::begin(const uint8_t *pins, uint8_t n)
+{
+	count = 0;
+	allMask = 0;
+	if (n == 0 || n > ONEWIRE_MULTI_MAX) return false;
+	baseReg = PIN_TO_BASEREG(pins[0]);
+	for (uint8_t i = 0; i < n; i++) {
+		if (PIN_TO_BASEREG(pins[i]) != baseReg) return false;
+		pinMode(pins[i], INPUT);
+		busMask[i] = PIN_TO_BITMASK(pins[i]);
+		allMask |= busMask[i];
+	}
+	count = n;
+	return true;
+}
+
+// Reset every bus and collect the presence pulses, as in OneWire::reset()
+uint8_t OneWireMulti::reset(void)
+{
+	IO_REG_TYPE mask IO_REG_MASK_ATTR = allMask;
+	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
+	IO_REG_TYPE seen = 0;
+	uint8_t retries = 125;
+
+	noInterrupts();
+	DIRECT_MODE_INPUT(reg, mask);
+	interrupts();
+	// wait until the wires are high... just in case; a bus still held
+	// low after 250uS is shorted and will not report a presence
+	while ((*reg & mask) != mask) {
+		if (--retries == 0) break;
+		delayMicroseconds(2);
+	}
+	IO_REG_TYPE shorted = ~*reg & mask;
+
+	noInterrupts();
+	DIRECT_WRITE_LOW(reg, mask);
+	DIRECT_MODE_OUTPUT(reg, mask);	// drive outputs low
+	interrupts();
+	delayMicroseconds(480);
+	noInterrupts();
+	DIRECT_MODE_INPUT(reg, mask);	// allow them to float
+	interrupts();
+	// poll for presence pulses from 15uS (tPDH min) to 235uS, as in
+	// OneWire::reset(); an earlier sample could catch a slow cable
+	// still rising and report a device on an empty bus
+	delayMicroseconds(15);
+	for (uint8_t i = 0; i < 23; i++) {
+		seen |= ~*reg & mask;
+		delayMicroseconds(10);
+	}
+	delayMicroseconds(235);
+
+	seen &= ~shorted;
+	uint8_t r = 0;
+	for (uint8_t i = 0; i < count; i++)
+		if (seen & busMask[i]) r |= 1 << i;
+	return r;
+}
+
+// One write slot on every bus; the buses in 'ones' write a 1, the others a 0
+void OneWireMulti::write_slot(IO_REG_TYPE ones)
+{
+	IO_REG_TYPE mask IO_REG_MASK_ATTR = allMask;
+	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
+
+	noInterrupts();
+	DIRECT_WRITE_LOW(reg, mask);
+	DIRECT_MODE_OUTPUT(reg, mask);	// drive outputs low
+	delayMicroseconds(6);
+	DIRECT_WRITE_HIGH(reg, ones);	// end of the 1 slots
+	interrupts();
+	delayMicroseconds(54);			// interrupts may stretch this
+	noInterrupts();
+	DIRECT_WRITE_HIGH(reg, mask);	// end of the 0 slots
+	interrupts();
+	delayMicroseconds(10);
+}
+
+// One read slot on every bus, returns the port bits that read 1
+IO_REG_TYPE OneWireMulti::read_slot(void)
+{
+	IO_REG_TYPE mask IO_REG_MASK_ATTR = allMask;
+	volatile IO_REG_TYPE *reg IO_REG_BASE_ATTR = baseReg;
+	IO_REG_TYPE r;
+
+	noInterrupts();
+	DIRECT_MODE_OUTPUT(reg, mask);
+	DIRECT_WRITE_LOW(reg, mask);
+	delayMicroseconds(3);
+	DIRECT_MODE_INPUT(reg, mask);	// let pins float, pull ups will raise
+	delayMicroseconds(8);
+	r = *reg & mask;
+	interrupts();
+	delayMicroseconds(55);
+	return r;
+}
+
+void OneWireMulti::write(uint8_t v, uint8_t power /* = 0 */)
+{
+	for (uint8_t bitMask = 0x01; bitMask; bitMask <<= 1)
+		write_slot((v & bitMask) ? allMask : 0);
+	if (!power) depower();
+}
+
+void OneWireMulti::write_each(const uint8_t *values, uint8_t power /* = 0 */)
+{
+	for (uint8_t bitMask = 0x01; bitMask; bitMask <<= 1) {
+		IO_REG_TYPE ones = 0;
+		for (uint8_t i = 0; i < count; i++)
+			if (values[i] & bitMask) ones |= busMask[i];
+		write_slot(ones);
+	}
+	if (!power) depower();
+}
+
+void OneWireMulti::read(uint8_t *values)
+{
+	for (uint8_t i = 0; i < count; i++) values[i] = 0;
+	for (uint8_t bitMask = 0x01; bitMask; bitMask <<= 1) {
+		IO_REG_TYPE r = read_slot();
+		for (uint8_t i = 0; i < count; i++)
+			if (r & busMask[i]) values[i] |= bitMask;
+	}
+}
+
+void OneWireMulti::skip(void)
+{
+	write(0xCC);           // Skip ROM
+}
+
+void OneWireMulti::select(const uint8_t roms[][8])
+{
+	uint8_t values[ONEWIRE_MULTI_MAX];
+
+	write(0x55);           // Choose ROM
+	for (uint8_t k = 0; k < 8; k++) {
+		for (uint8_t i = 0; i < count; i++) values[i] = roms[i][k];
+		write_each(values);
+	}
+}
+
+void OneWireMulti::depower(void)
+{
+	noInterrupts();
+	DIRECT_MODE_INPUT(baseReg, allMask);
+	DIRECT_WRITE_LOW(baseReg, allMask);
+	interrupts();
+}
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef OneWireMulti_h
+#define OneWireMulti_h
+
+#ifdef __cplusplus
+
+#include <stdint.h>
+
+#if ARDUINO >= 100
+#include <Arduino.h>
+#else
+#include "WProgram.h"
+#endif
+
+// Several 1-Wire buses on pins of the same AVR port, driven in lockstep.
+//
+// Every bit slot drives and samples all buses with one port access, so a
+// reset, a conversion command or a scratchpad read takes the same time
+// for N buses as for one.  Each bus can still carry different data:
+// write_each() and select() send a different byte per bus, read() returns
+// one byte per bus.  A bus is numbered by the position of its pin in the
+// list given to begin(); functions returning a set of buses use bit i for
+// bus i.
+//
+//    static const uint8_t pins[] = {2, 3, 4};    // PD2, PD3, PD4
+//    OneWireMulti buses;
+//    uint8_t scratchPad[3][9];
+//
+//    buses.begin(pins, 3);
+//    if (buses.reset() == 0x07) {
+//      buses.skip();
+//      buses.write(0xBE);                      // read scratchpad
+//      for (uint8_t k = 0; k < 9; k++) {
+//        uint8_t v[3];
+//        buses.read(v);
+//        for (uint8_t i = 0; i < 3; i++) scratchPad[i][k] = v[i];
+//      }
+//    }
+//
+// Standard speed, bit-banged GPIO on AVR only.
+
+#if !defined(__AVR__)
+#error "OneWireMulti needs an AVR: it drives several pins with one port access"
+#endif
+
+#define ONEWIRE_MULTI_MAX 8
+
+// Board-specific macros for direct GPIO.  OneWire.h undefines
+// IO_REG_TYPE after use, so the header may have to be read again.
+#undef OneWire_Direct_RegType_h
+#include "util/OneWire_direct_regtype.h"
+
+class OneWireMulti
+{
+  private:
+    uint8_t count;
+    IO_REG_TYPE allMask;                    // every bus pin on the port
+    IO_REG_TYPE busMask[ONEWIRE_MULTI_MAX]; // port bit of each bus
+    volatile IO_REG_TYPE *baseReg;
+
+    void write_slot(IO_REG_TYPE ones);
+    IO_REG_TYPE read_slot(void);
+
+  public:
+    OneWireMulti() : count(0), allMask(0) { }
+
+    // Returns false if there are more than ONEWIRE_MULTI_MAX pins or they
+    // are not all on the same port.
+    bool begin(const uint8_t *pins, uint8_t n);
+    uint8_t buses(void) const { return count; }
+
+    // Reset every bus.  Returns the set of buses on which a device
+    // asserted a presence pulse.
+    uint8_t reset(void);
+
+    // Issue a 1-Wire rom skip command on every bus.
+    void skip(void);
+
+    // Issue a 1-Wire rom select command with a different ROM per bus,
+    // roms[i] for bus i.
+    void select(const uint8_t roms[][8]);
+
+    // Write the same byte to every bus.  See OneWire::write() about 'power'.
+    void write(uint8_t v, uint8_t power = 0);
+
+    // Write values[i] to bus i.
+    void write_each(const uint8_t *values, uint8_t power = 0);
+
+    // Read one byte from every bus into values[i].
+    void read(uint8_t *values);
+
+    // Stop forcing power onto the buses.
+    void depower(void);
+};
+
+// Prevent this name from leaking into Arduino sketches
+#ifdef IO_REG_TYPE
+#undef IO_REG_TYPE
+#endif
+
+#endif // __cplusplus
+#endif // OneWireMulti_h
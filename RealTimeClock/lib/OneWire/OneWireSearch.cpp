@@ -0,0 +1,94 @@
+// Resumable ROM search, see OneWireSearch.h
+//
+// The algorithm is OneWire::search() (Maxim application note 187) with
+// the bit loop split across calls: bitNumber, lastZero and rom[] carry
+// the position inside a pass, lastDiscrepancy and lastDevice the
+// position in the enumeration.
+
+#include "OneWireSearch.h"
+
+#if ONEWIRE_SEARCH
+
+void OneWireSearch::begin(OneWire &bus, bool search_mode /* = true */)
+{
+	wire = &bus;
+	searchMode = search_mode;
+	restart();
+}
+
+void OneWireSearch::restart(void)
+{
+	bitNumber = 0;
+	lastDiscrepancy = 0;
+	lastDevice = false;
+	for (uint8_t i = 0; i < 8; i++) rom[i] = 0;
+}
+
+uint8_t OneWireSearch::step(uint8_t bits /* = 8 */)
+{
+	// start of a pass
+	if (bitNumber == 0) {
+		if (lastDevice || !wire->reset()) {
+			restart();
+			return ONEWIRE_SEARCH_DONE;
+		}
+		if (searchMode == true) {
+			wire->write(0xF0);   // NORMAL SEARCH
+		} else {
+			wire->write(0xEC);   // CONDITIONAL SEARCH
+		}
+		bitNumber = 1;
+		lastZero = 0;
+		return ONEWIRE_SEARCH_BUSY;
+	}
+
+	while (bits--) {
+		uint8_t romByte = (bitNumber - 1) >> 3;
+		uint8_t romMask = 1 << ((bitNumber - 1) & 7);
+		uint8_t direction;
+
+		// read a bit and its complement
+		uint8_t id_bit = wire->read_bit();
+		uint8_t cmp_id_bit = wire->read_bit();
+
+		// no devices answered
+		if (id_bit && cmp_id_bit) {
+			restart();
+			return ONEWIRE_SEARCH_DONE;
+		}
+
+		if (id_bit != cmp_id_bit) {
+			// all devices coupled have 0 or 1
+			direction = id_bit;
+		} else {
+			// discrepancy: before the last one take the same branch as
+			// last time, at the last one take 1, beyond it take 0
+			if (bitNumber < lastDiscrepancy)
+				direction = (rom[romByte] & romMask) != 0;
+			else
+				direction = (bitNumber == lastDiscrepancy);
+			if (direction == 0) lastZero = bitNumber;
+		}
+
+		if (direction)
+			rom[romByte] |= romMask;
+		else
+			rom[romByte] &= ~romMask;
+		wire->write_bit(direction);
+
+		if (++bitNumber == 65) {
+			// device complete, the next step starts a new pass
+			bitNumber = 0;
+			lastDiscrepancy = lastZero;
+			if (lastDiscrepancy == 0) lastDevice = true;
+			if (!rom[0]) {
+				restart();
+				return ONEWIRE_SEARCH_DONE;
+			}
+			return ONEWIRE_SEARCH_FOUND;
+		}
+	}
+	return ONEWIRE_SEARCH_BUSY;
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef OneWireSearch_h
+#define OneWireSearch_h
+
+#ifdef __cplusplus
+
+#include <stdint.h>
+
+#if ARDUINO >= 100
+#include <Arduino.h>
+#else
+#include "WProgram.h"
+#endif
+
+#include "OneWire.h"
+
+#if ONEWIRE_SEARCH
+
+// Resumable ROM search.
+//
+// OneWire::search() walks all 64 ROM bits of a device in one call, about
+// 15mS per device.  OneWireSearch runs the same algorithm a few bits per
+// call to step() and keeps its place in between, so a sketch can look for
+// devices from loop() without stalling it.  A pass (one device) is a
+// reset and search command followed by 64 bits; each bit is three slots,
+// about 0.2mS.
+//
+// The bus may sit idle between steps, the devices simply wait for the
+// next slot.  If anything else talks on the bus in the meantime, call
+// restart_pass() before the next step(): the interrupted device is then
+// searched again from its reset.
+//
+//    OneWireSearch finder(oneWire);
+//    ...
+//    switch (finder.step()) {
+//      case ONEWIRE_SEARCH_FOUND:   use(finder.address()); break;
+//      case ONEWIRE_SEARCH_DONE:    all devices seen, the next step
+//                                   starts over from the first one
+//    }
+
+// step() results
+#define ONEWIRE_SEARCH_BUSY  0 // search in progress
+#define ONEWIRE_SEARCH_FOUND 1 // a device was found, see address()
+#define ONEWIRE_SEARCH_DONE  2 // no more devices, no device at all or
+                               // the bus failed; the search starts over
+
+class OneWireSearch
+{
+  private:
+    OneWire *wire;
+    uint8_t rom[8];
+    uint8_t bitNumber;         // next ROM bit 1-64, 0 before the reset
+    uint8_t lastZero;
+    uint8_t lastDiscrepancy;
+    bool lastDevice;
+    bool searchMode;
+
+  public:
+    OneWireSearch() : wire(NULL) { restart(); }
+    OneWireSearch(OneWire &bus, bool search_mode = true) { begin(bus, search_mode); }
+
+    // search_mode false looks only for devices with an active alarm
+    // (conditional search), as in OneWire::search()
+    void begin(OneWire &bus, bool search_mode = true);
+
+    // Forget the devices seen so far and start with the first one
+    void restart(void);
+
+    // The bus was used since the last step(); search the current device
+    // again from its reset
+    void restart_pass(void) { bitNumber = 0; }
+
+    // Advance the search by up to 'bits' ROM bits.  The reset and search
+    // command of each pass take a step of their own.  Returns one of
+    // ONEWIRE_SEARCH_xxx.
+    uint8_t step(uint8_t bits = 8);
+
+    // ROM of the device reported by the last ONEWIRE_SEARCH_FOUND.  As
+    // with search(), check its CRC before use.
+    const uint8_t *address(void) const { return rom; }
+};
+
+#endif // ONEWIRE_SEARCH
+
+#endif // __cplusplus
+#endif // OneWireSearch_h
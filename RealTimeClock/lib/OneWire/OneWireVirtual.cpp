@@ -0,0 +1,409 @@
+// Simulated 1-Wire bus for host builds, see OneWireVirtual.h
+//
+// The master side is the state of the pin (input, or output low/high)
+// as set by the DIRECT_xxx macros.  Every change is handled at the bus
+// time it happens:
+//
+//   falling edge:  a slot starts, devices that are sending a 0 hold the
+//                  line low for the next 30uS
+//   rising edge:   the low time decides the slot: 480uS or more is a
+//                  reset (presence pulse 30-150uS later), under 15uS a
+//                  1, otherwise a 0, which receiving devices shift in
+//
+// Reads return the wired AND of the master, the presence pulse and every
+// device holding the line.  Conversions end lazily, the first time the
+// bus is looked at after their end time.
+
+#include "OneWireVirtual.h"
+
+#if ONEWIRE_VIRTUAL_BUS
+
+#define FAMILY_DS18S20 0x10
+
+// device states
+#define ST_IDLE       0 // wait for a reset
+#define ST_ROM        1 // receive the ROM command
+#define ST_MATCH      2 // receive the ROM code of Match ROM
+#define ST_SEARCH     3 // Search or Alarm Search
+#define ST_READ_ROM   4 // send the ROM code
+#define ST_FUNCTION   5 // receive the function command
+#define ST_WRITE_PAD  6 // receive TH, TL and configuration
+#define ST_READ_PAD   7 // send the scratchpad
+#define ST_STATUS     8 // read slots give 0 while converting, then 1
+#define ST_POWER      9 // read slots give 0 for a parasite powered device
+
+#define RESET_TIME    480 // shortest low pulse taken as a reset
+#define WRITE_1_TIME  15  // longest low pulse taken as a 1
+#define HOLD_TIME     30  // a device sending 0 holds the line this long
+#define SLOT_TIME     60  // a corrupted read slot lasts this long
+
+static OneWireVirtualDevice *devices = NULL;
+static unsigned long busTime = 0;
+static bool masterOutput = false;
+static bool masterHigh = false;
+static unsigned long lowStart;
+static unsigned long presenceFrom = 0, presenceTo = 0;
+static uint32_t slotCount = 0;
+static uint32_t errorSlot = 0;
+static bool corrupt = false;
+
+class OneWireVirtualBus
+{
+  public:
+    static bool master_low(void) { return masterOutput && !masterHigh; }
+    static void changed(bool wasLow);
+    static bool held(void);
+    static void attach(OneWireVirtualDevice *dev);
+    static void detach(OneWireVirtualDevice *dev);
+};
+
+OneWireVirtualDevice::OneWireVirtualDevice(uint8_t family, uint32_t serial, bool parasite_power /* = false */)
+{
+	rom[0] = family;
+	for (uint8_t i = 1; i < 7; i++) {
+		rom[i] = serial & 0xFF;
+		serial >>= 8;
+	}
+	rom[7] = OneWire::crc8(rom, 7);
+	parasitePower = parasite_power;
+	eeprom[0] = 0x4B;    // TH 75C
+	eeprom[1] = 0x46;    // TL 70C
+	eeprom[2] = 0x7F;    // 12 bit
+	temperature = 25 * 16;
+	conversions = 0;
+	next = NULL;
+	power_on();
+}
+
+void OneWireVirtualDevice::power_on(void)
+{
+	if (rom[0] == FAMILY_DS18S20) {
+		pad[0] = 0xAA;   // 85C
+		pad[1] = 0x00;
+		pad[4] = 0xFF;
+	} else {
+		pad[0] = 0x50;   // 85C
+		pad[1] = 0x05;
+		pad[4] = eeprom[2];
+	}
+	pad[2] = eeprom[0];
+	pad[3] = eeprom[1];
+	pad[5] = 0xFF;
+	pad[6] = 0x0C;
+	pad[7] = 0x10;
+	state = ST_IDLE;
+	sending = false;
+	holdUntil = 0;
+	converting = false;
+}
+
+void OneWireVirtualDevice::set_temperature(float celsius)
+{
+	temperature = (int16_t)(celsius * 16 + (celsius < 0 ? -0.5f : 0.5f));
+}
+
+void OneWireVirtualDevice::scratchpad(uint8_t *buf)
+{
+	for (uint8_t i = 0; i < 8; i++) buf[i] = pad[i];
+	buf[8] = OneWire::crc8(pad, 8);
+}
+
+uint8_t OneWireVirtualDevice::resolution(void) const
+{
+	if (rom[0] == FAMILY_DS18S20) return 12;    // always 750mS
+	return ((pad[4] >> 5) & 0x03) + 9;
+}
+
+// Alarm flag of the last conversion: whole degrees >= TH or <= TL
+bool OneWireVirtualDevice::alarm(void) const
+{
+	int16_t raw = (int16_t)((pad[1] << 8) | pad[0]);
+	int8_t t = (rom[0] == FAMILY_DS18S20) ? raw >> 1 : raw >> 4;
+	return t >= (int8_t)pad[2] || t <= (int8_t)pad[3];
+}
+
+void OneWireVirtualDevice::finish_conversion(void)
+{
+	if (!converting || busTime < conversionEnd) return;
+	converting = false;
+	conversions++;
+
+	if (rom[0] == FAMILY_DS18S20) {
+		// 0.5C register plus COUNT_REMAIN, see calculateTemperature()
+		int16_t t = temperature + 4;
+		int16_t reg = t >> 3;
+		pad[0] = reg & 0xFF;
+		pad[1] = reg >> 8;
+		pad[6] = 16 - (t - ((t >> 4) << 4));
+		pad[7] = 0x10;
+	} else {
+		// bits below the resolution are 0
+		int16_t raw = temperature & ~((1 << (12 - resolution())) - 1);
+		pad[0] = raw & 0xFF;
+		pad[1] = raw >> 8;
+	}
+}
+
+void OneWireVirtualDevice::bus_reset(void)
+{
+	state = ST_ROM;
+	rx = 0;
+	rxBits = 0;
+	count = 0;
+	holdUntil = 0;
+}
+
+// Bit this device puts on the bus in the read slot starting now
+uint8_t OneWireVirtualDevice::send_bit(void)
+{
+	uint8_t b;
+
+	switch (state) {
+	case ST_SEARCH:
+		b = (rom[count >> 3] >> (count & 7)) & 1;
+		if (searchPhase++ == 0) return b;
+		return !b;                          // complement, then direction
+	case ST_READ_ROM:
+		b = (rom[count >> 3] >> (count & 7)) & 1;
+		if (++count == 64) state = ST_FUNCTION;
+		return b;
+	case ST_READ_PAD:
+		if (count >= 72) return 1;
+		b = (count < 64) ? pad[count >> 3] : OneWire::crc8(pad, 8);
+		b = (b >> (count & 7)) & 1;
+		count++;
+		return b;
+	case ST_STATUS:
+		// a parasite powered device cannot pull the line while converting
+		return !(converting && !parasitePower);
+	case ST_POWER:
+		return !parasitePower;
+	}
+	return 1;
+}
+
+void OneWireVirtualDevice::slot_start(unsigned long now)
+{
+	sending = (state >= ST_READ_ROM && state != ST_FUNCTION && state != ST_WRITE_PAD) ||
+		(state == ST_SEARCH && searchPhase < 2);
+	if (sending && !send_bit()) holdUntil = now + HOLD_TIME;
+}
+
+void OneWireVirtualDevice::slot_end(uint8_t bit)
+{
+	if (sending) {
+		sending = false;
+		return;
+	}
+
+	switch (state) {
+	case ST_ROM:
+	case ST_FUNCTION:
+	case ST_WRITE_PAD:
+		rx |= bit << rxBits;
+		if (++rxBits == 8) {
+			uint8_t b = rx;
+			rx = 0;
+			rxBits = 0;
+			received(b);
+		}
+		break;
+	case ST_MATCH:
+		if (bit != ((rom[count >> 3] >> (count & 7)) & 1))
+			state = ST_IDLE;
+		else if (++count == 64)
+			state = ST_FUNCTION;
+		break;
+	case ST_SEARCH:
+		// direction chosen by the master, devices that differ drop out
+		if (bit != ((rom[count >> 3] >> (count & 7)) & 1)) {
+			state = ST_IDLE;
+			break;
+		}
+		searchPhase = 0;
+		if (++count == 64) state = ST_FUNCTION;
+		break;
+	}
+}
+
+void OneWireVirtualDevice::received(uint8_t b)
+{
+	if (state == ST_ROM) {
+		count = 0;
+		searchPhase = 0;
+		switch (b) {
+		case 0x33: state = ST_READ_ROM; break;
+		case 0x55: state = ST_MATCH; break;
+		case 0xCC: state = ST_FUNCTION; break;
+		case 0xF0: state = ST_SEARCH; break;
+		case 0xEC: state = alarm() ? ST_SEARCH : ST_IDLE; break;
+		default:   state = ST_IDLE; break;   // overdrive is not supported
+		}
+		return;
+	}
+
+	if (state == ST_WRITE_PAD) {
+		// TH, TL, and the configuration except on the DS18S20
+		if (count < 2) {
+			pad[2 + count] = b;
+		} else if (count == 2 && rom[0] != FAMILY_DS18S20) {
+			pad[4] = (b & 0x60) | 0x1F;
+		}
+		if (++count == 3) state = ST_IDLE;
+		return;
+	}
+
+	count = 0;
+	switch (b) {
+	case 0x44:  // Convert T
+		converting = true;
+		conversionEnd = busTime + (750000UL >> (12 - resolution()));
+		state = ST_STATUS;
+		break;
+	case 0xBE:  // Read Scratchpad
+		state = ST_READ_PAD;
+		break;
+	case 0x4E:  // Write Scratchpad
+		state = ST_WRITE_PAD;
+		break;
+	case 0x48:  // Copy Scratchpad
+		eeprom[0] = pad[2];
+		eeprom[1] = pad[3];
+		eeprom[2] = pad[4];
+		state = ST_STATUS;
+		break;
+	case 0xB8:  // Recall EEPROM
+		pad[2] = eeprom[0];
+		pad[3] = eeprom[1];
+		if (rom[0] != FAMILY_DS18S20) pad[4] = eeprom[2];
+		state = ST_STATUS;
+		break;
+	case 0xB4:  // Read Power Supply
+		state = ST_POWER;
+		break;
+	default:
+		state = ST_IDLE;
+		break;
+	}
+}
+
+// The master pin changed, wasLow is the level it drove before
+void OneWireVirtualBus::changed(bool wasLow)
+{
+	bool low = master_low();
+	OneWireVirtualDevice *dev;
+
+	for (dev = devices; dev; dev = dev->next)
+		dev->finish_conversion();
+
+	if (low && !wasLow) {
+		lowStart = busTime;
+		slotCount++;
+		corrupt = (slotCount == errorSlot);
+		for (dev = devices; dev; dev = dev->next)
+			dev->slot_start(busTime);
+	} else if (!low && wasLow) {
+		unsigned long width = busTime - lowStart;
+		if (width >= RESET_TIME) {
+			for (dev = devices; dev; dev = dev->next)
+				dev->bus_reset();
+			if (devices) {
+				presenceFrom = busTime + 30;
+				presenceTo = busTime + 150;
+			}
+		} else {
+			uint8_t bit = (width < WRITE_1_TIME) ^ corrupt;
+			for (dev = devices; dev; dev = dev->next)
+				dev->slot_end(bit);
+		}
+	}
+
+	// a parasite powered device converting needs the bus driven high
+	if (!(masterOutput && masterHigh)) {
+		for (dev = devices; dev; dev = dev->next)
+			if (dev->converting && dev->parasitePower)
+				dev->power_on();
+	}
+}
+
+bool OneWireVirtualBus::held(void)
+{
+	if (busTime >= presenceFrom && busTime < presenceTo) return true;
+	for (OneWireVirtualDevice *dev = devices; dev; dev = dev->next)
+		if (busTime < dev->holdUntil) return true;
+	return false;
+}
+
+void OneWireVirtualBus::attach(OneWireVirtualDevice *dev)
+{
+	detach(dev);
+	dev->next = devices;
+	devices = dev;
+}
+
+void OneWireVirtualBus::detach(OneWireVirtualDevice *dev)
+{
+	for (OneWireVirtualDevice **p = &devices; *p; p = &(*p)->next) {
+		if (*p == dev) {
+			*p = dev->next;
+			dev->next = NULL;
+			return;
+		}
+	}
+}
+
+void onewire_virtual_attach(OneWireVirtualDevice *dev)
+{
+	OneWireVirtualBus::attach(dev);
+}
+
+void onewire_virtual_detach(OneWireVirtualDevice *dev)
+{
+	OneWireVirtualBus::detach(dev);
+}
+
+void onewire_virtual_bit_error(uint32_t slot)
+{
+	errorSlot = slotCount + slot;
+}
+
+unsigned long onewire_virtual_micros(void)
+{
+	return busTime;
+}
+
+uint32_t onewire_virtual_slots(void)
+{
+	return slotCount;
+}
+
+uint8_t onewire_virtual_read(unsigned int pin)
+{
+	(void)pin;
+	uint8_t v = !(OneWireVirtualBus::master_low() || OneWireVirtualBus::held());
+	if (corrupt && busTime - lowStart < SLOT_TIME) v = !v;
+	return v;
+}
+
+void onewire_virtual_write(unsigned int pin, uint8_t high)
+{
+	(void)pin;
+	bool wasLow = OneWireVirtualBus::master_low();
+	masterHigh = high;
+	OneWireVirtualBus::changed(wasLow);
+}
+
+void onewire_virtual_mode(unsigned int pin, uint8_t output)
+{
+	(void)pin;
+	bool wasLow = OneWireVirtualBus::master_low();
+	masterOutput = output;
+	OneWireVirtualBus::changed(wasLow);
+}
+
+void onewire_virtual_delay(unsigned int us)
+{
+	busTime += us;
+}
+
+#endif
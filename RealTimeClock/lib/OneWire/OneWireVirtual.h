@@ -0,0 +1,129 @@
+#ifndef OneWireVirtual_h
+#define OneWireVirtual_h
+
+#ifdef __cplusplus
+
+#include <stdint.h>
+
+#include "OneWire.h"       // for ONEWIRE_VIRTUAL_BUS
+
+#if ONEWIRE_VIRTUAL_BUS
+
+// Simulated 1-Wire bus with DS18B20, DS1822 and DS18S20 devices, for host
+// builds with ONEWIRE_VIRTUAL_BUS (see OneWire.h).
+//
+// OneWire and OneWireAsync drive the model through the DIRECT_xxx macros
+// of util/OneWire_direct_gpio.h.  The model keeps its own clock in
+// microseconds, advanced by the library's delayMicroseconds() calls, and
+// works at slot level like the real devices: the length of each low
+// pulse is a reset (480uS or more), a 1 (under 15uS) or a 0, and a
+// device sending a 0 holds the line low for 30uS from the start of the
+// slot.  Several devices answering in the same read slot give the wired
+// AND, so search() sees real collisions and Read ROM with more than one
+// device reads garbage.
+//
+// Supported: Read ROM, Match ROM, Skip ROM, Search and Alarm Search;
+// Convert T, Read and Write Scratchpad, Copy Scratchpad, Recall EEPROM
+// and Read Power Supply.  A conversion takes 94-750mS by resolution.
+// During it an externally powered device reads back 0 slots.  A
+// parasite powered one needs the bus driven high (the 'power' option of
+// write()) until the conversion ends.  Otherwise it loses power and its
+// scratchpad reads 85C, the power on value.  Overdrive is not supported,
+// as on the real devices.
+//
+// There is one bus; the pin number is ignored.  DallasTemperature calls
+// delay() and millis() itself, so those must run on the bus clock too:
+// test/native/Arduino.h builds them on onewire_virtual_delay() and
+// onewire_virtual_micros() for [env:native], whose tests in
+// test/test_onewire_virtual use the model like this:
+//
+//    OneWireVirtualDevice probe(0x28, 1), outside(0x10, 2, true);
+//    OneWire bus(2);
+//    DallasTemperature sensors(&bus);
+//
+//    onewire_virtual_attach(&probe);
+//    onewire_virtual_attach(&outside);
+//    probe.set_temperature(21.5);
+//    outside.set_temperature(-3.25);
+//    sensors.begin();
+//    sensors.requestTemperatures();
+//    float t = sensors.getTempC(probe.address());
+//    ...
+//    onewire_virtual_bit_error(1);    // the next slot goes wrong
+
+class OneWireVirtualDevice
+{
+  public:
+    // ROM code is family, 'serial' (6 bytes, low byte first) and CRC
+    OneWireVirtualDevice(uint8_t family, uint32_t serial, bool parasite_power = false);
+
+    const uint8_t *address(void) const { return rom; }
+    bool parasite(void) const { return parasitePower; }
+
+    // Temperature the next conversion reports, rounded to 1/16 degree
+    void set_temperature(float celsius);
+
+    // Scratchpad as the device would send it, CRC included
+    void scratchpad(uint8_t *buf);
+
+    // Power on the device again: scratchpad back to 85C and the
+    // EEPROM alarm and configuration values
+    void power_on(void);
+
+    // Conversions started and finished since construction
+    uint16_t conversions;
+
+  private:
+    friend class OneWireVirtualBus;
+
+    uint8_t rom[8];
+    uint8_t pad[8];           // scratchpad without the CRC
+    uint8_t eeprom[3];        // TH, TL, configuration
+    int16_t temperature;      // 1/16 degree
+    bool parasitePower;
+
+    uint8_t state;
+    uint8_t rx, rxBits;       // byte being received
+    uint8_t count;            // bits or bytes done in this state
+    uint8_t searchPhase;      // search: bit, complement, direction
+    bool sending;             // this device drives the current slot
+    unsigned long holdUntil;  // end of a 0 this device is sending
+    bool converting;
+    unsigned long conversionEnd;
+
+    OneWireVirtualDevice *next;
+
+    bool alarm(void) const;
+    uint8_t resolution(void) const;
+    void finish_conversion(void);
+    void bus_reset(void);
+    void slot_start(unsigned long now);
+    void slot_end(uint8_t bit);
+    void received(uint8_t b);
+    uint8_t send_bit(void);
+};
+
+// Put a device on the bus or take it off; a detached device no longer
+// answers, like an unplugged probe
+void onewire_virtual_attach(OneWireVirtualDevice *dev);
+void onewire_virtual_detach(OneWireVirtualDevice *dev);
+
+// Corrupt slot number 'slot' from now on (1 is the next slot): the
+// master reads the inverted bit, or the devices receive it
+void onewire_virtual_bit_error(uint32_t slot);
+
+// Bus clock in microseconds, and the number of slots (every low pulse
+// driven by the master, resets included) since the start
+unsigned long onewire_virtual_micros(void);
+uint32_t onewire_virtual_slots(void);
+
+// Hooks for util/OneWire_direct_gpio.h
+uint8_t onewire_virtual_read(unsigned int pin);
+void onewire_virtual_write(unsigned int pin, uint8_t high);
+void onewire_virtual_mode(unsigned int pin, uint8_t output);
+void onewire_virtual_delay(unsigned int us);
+
+#endif // ONEWIRE_VIRTUAL_BUS
+
+#endif // __cplusplus
+#endif // OneWireVirtual_h
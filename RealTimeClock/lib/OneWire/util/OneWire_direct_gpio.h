@@ -1,15 +1,33 @@
 #ifndef OneWire_Direct_GPIO_h
 #define OneWire_Direct_GPIO_h
 
-// This header should ONLY be included by OneWire.cpp.  These defines are
-// meant to be private, used within OneWire.cpp, but not exposed to Arduino
-// sketches or other libraries which may include OneWire.h.
+// This header should ONLY be included by OneWire.cpp, OneWireAsync.cpp and
+// OneWireMulti.cpp.
+// These defines are meant to be private, used within those files, but not
+// exposed to Arduino sketches or other libraries which may include OneWire.h.
 
 #include <stdint.h>
 
 // Platform specific I/O definitions
 
-#if defined(__AVR__)
+#if defined(ONEWIRE_VIRTUAL_BUS) && ONEWIRE_VIRTUAL_BUS
+// Simulated bus for host builds, see OneWireVirtual.h.  Bus time only
+// passes in delayMicroseconds(), which is redirected to the model.
+#include "OneWireVirtual.h"
+#define PIN_TO_BASEREG(pin)             (0)
+#define PIN_TO_BITMASK(pin)             (pin)
+#define IO_REG_TYPE unsigned int
+#define IO_REG_BASE_ATTR
+#define IO_REG_MASK_ATTR
+#define DIRECT_READ(base, pin)          ((void)(base), onewire_virtual_read(pin))
+#define DIRECT_WRITE_LOW(base, pin)     ((void)(base), onewire_virtual_write(pin, 0))
+#define DIRECT_WRITE_HIGH(base, pin)    ((void)(base), onewire_virtual_write(pin, 1))
+#define DIRECT_MODE_INPUT(base, pin)    ((void)(base), onewire_virtual_mode(pin, 0))
+#define DIRECT_MODE_OUTPUT(base, pin)   ((void)(base), onewire_virtual_mode(pin, 1))
+#undef delayMicroseconds
+#define delayMicroseconds(us)           onewire_virtual_delay(us)
+
+#elif defined(__AVR__)
 #define PIN_TO_BASEREG(pin)             (portInputRegister(digitalPinToPort(pin)))
 #define PIN_TO_BITMASK(pin)             (digitalPinToBitMask(pin))
 #define IO_REG_TYPE uint8_t
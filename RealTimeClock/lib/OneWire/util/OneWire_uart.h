@@ -0,0 +1,59 @@
+#ifndef OneWire_UART_h
+#define OneWire_UART_h
+
+// 1-Wire on the AVR USART (ONEWIRE_UART).  This header should ONLY be
+// included by OneWire.cpp and OneWireAsync.cpp.
+//
+// Every 1-Wire slot is one 8N1 frame.  At 115200 baud the start bit is
+// an 8.7uS low pulse, and each data bit that is 0 extends it:
+//
+//   write 1 / read:  send 0xFF, the device may pull the line low during
+//                    the frame; the byte read back is 0xFF for a 1
+//   write 0:         send 0x00, 78uS low
+//   reset:           at 9600 baud send 0xF0, 520uS low; a presence
+//                    pulse corrupts the upper bits read back
+//
+// TX drives the bus through an open-drain buffer or a Schottky diode
+// (cathode to TX), RX is connected to the bus with its pull-up resistor.
+// The USART shifts every bit, so no interrupts are ever disabled and
+// the slot timing has no jitter.  The bus cannot be driven high, so the
+// 'power' option of write() has no effect: parasite powered devices need
+// a strong pull-up (see DallasTemperature::setPullupPin()).
+//
+// USART0 and its RX interrupt are taken; Serial cannot be used.
+
+#if defined(__AVR__) && defined(UDR0)
+
+#define ONEWIRE_UART_RESET_UBRR ((F_CPU / 8 / 9600) - 1)   // U2X0 set
+#define ONEWIRE_UART_SLOT_UBRR  ((F_CPU / 8 / 115200) - 1)
+
+static inline void onewire_uart_begin(void)
+{
+	UCSR0B = 0;
+	UBRR0 = ONEWIRE_UART_SLOT_UBRR;
+	UCSR0A = _BV(U2X0);
+	UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);       // 8N1
+	UCSR0B = _BV(RXEN0) | _BV(TXEN0);
+}
+
+// Switch between the reset and the slot bit rate.  Only called between
+// frames, with the line idle (high).
+static inline void onewire_uart_baud(bool reset)
+{
+	UBRR0 = reset ? ONEWIRE_UART_RESET_UBRR : ONEWIRE_UART_SLOT_UBRR;
+}
+
+// Send one frame and return the byte read back from the bus
+static inline uint8_t onewire_uart_touch(uint8_t v)
+{
+	while (UCSR0A & _BV(RXC0)) (void)UDR0;    // drop stale input
+	UDR0 = v;
+	while (!(UCSR0A & _BV(RXC0))) ;
+	return UDR0;
+}
+
+#else
+#error "ONEWIRE_UART needs an AVR with USART0"
+#endif
+
+#endif
@@ -0,0 +1,226 @@
+/////////////////////////////////////////////////////////////////////
+//
+//	Arduino RealTimeClock
+//
+//	OLED display benchmark suite
+//
+//	Build with the benchmark_i2c or benchmark_spi environment
+//	(platformio.ini). The clock application (main.cpp) is left out
+//	of these builds. Results are printed on the serial monitor
+//	at 115200 baud, once every 5 seconds.
+//
+//	Drawing operations (buffer only, no display transfer):
+//	clearDisplay, a line of text size 1 and 2, drawCircle
+//
+//	display() flushes:
+//	Full:   all 8 pages sent (checksums invalidated)
+//	Dirty:  one page changed, only that page sent
+//	Hashed: nothing changed, page checksums only
+//
+//	Bytes per frame are counted by the SSD1306 driver (SSD1306_STATS)
+//	and include I2C address and control bytes. Bus time is modeled
+//	from the byte count (9 bit times per I2C byte, 8 per SPI byte),
+//	CPU time is the measured frame time less the bus time.
+//
+/////////////////////////////////////////////////////////////////////
+
+#ifdef DISPLAY_BENCHMARK
+
+#include <SPI.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_I2CDevice.h>
+#include <Adafruit_SPIDevice.h>
+#include <Adafruit_SSD1306.h>
+#include "DisplayConfig.h"
+
+#define BENCHMARK_LOOPS 32
+
+// modeled bus time per byte in nanoseconds
+#ifdef OLED_SPI
+#define BUS_NS_PER_BYTE (8000000UL / (OLED_SPI_CLOCK / 1000))
+#else
+#define BUS_NS_PER_BYTE (9000000UL / (400000UL / 1000))
+#endif
+
+Adafruit_SSD1306_Fixed<SCREEN_WIDTH, SCREEN_HEIGHT> display(OLED_DISPLAY_ARGS);
+
+// operation selection
+enum
+  {
+  CLEAR_DISPLAY,
+  TEXT_SIZE_1,
+  TEXT_SIZE_2,
+  DRAW_CIRCLE,
+  FULL_FLUSH,
+  DIRTY_FLUSH,
+  HASHED_FLUSH,
+  };
+
+const char TextLine[] = "0123456789:0123456789";
+
+unsigned long runOperation(byte operation);
+void fillScreen();
+void printDrawResult(const __FlashStringHelper* name, unsigned long time);
+void printFlushResult(const __FlashStringHelper* name, unsigned long time);
+
+/////////////////////////////////////////////////////////////////////////
+// will be executed once at startup
+/////////////////////////////////////////////////////////////////////////
+void setup()
+  {
+  Serial.begin(115200);
+
+  // display screen SSD1306 initialization
+	if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C))
+    {
+    Serial.println(F("SSD1306 allocation failed"));
+    for(;;);
+    }
+  display.setTextColor(WHITE, BLACK);
+  return;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// benchmark loop
+/////////////////////////////////////////////////////////////////////////
+void loop()
+  {
+#ifdef OLED_SPI
+  Serial.println(F("SSD1306 hardware SPI 8MHz"));
+#else
+  Serial.println(F("SSD1306 I2C 400kHz"));
+#endif
+
+  Serial.println(F("Drawing           us/call"));
+  printDrawResult(F("clearDisplay      "), runOperation(CLEAR_DISPLAY));
+  printDrawResult(F("text size 1       "), runOperation(TEXT_SIZE_1));
+  printDrawResult(F("text size 2       "), runOperation(TEXT_SIZE_2));
+  printDrawResult(F("drawCircle        "), runOperation(DRAW_CIRCLE));
+
+  // every page has content for the flush tests
+  fillScreen();
+
+  Serial.println(F("display()         fps  bytes  us  bus-us  cpu-us"));
+  printFlushResult(F("full              "), runOperation(FULL_FLUSH));
+  printFlushResult(F("dirty (1 page)    "), runOperation(DIRTY_FLUSH));
+  printFlushResult(F("hashed (no change)"), runOperation(HASHED_FLUSH));
+
+  Serial.println();
+  delay(5000);
+  return;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// run one operation BENCHMARK_LOOPS times
+// returns total time in microseconds
+/////////////////////////////////////////////////////////////////////////
+unsigned long runOperation
+    (
+    byte operation
+    )
+  {
+  bool color = false;
+  display.resetBytesSent();
+  unsigned long start = micros();
+  for(byte pass = 0; pass < BENCHMARK_LOOPS; pass++)
+    {
+    switch(operation)
+      {
+      case CLEAR_DISPLAY:
+        display.clearDisplay();
+        break;
+
+      case TEXT_SIZE_1:
+        display.setTextSize(1);
+        display.setCursor(0, 0);
+        display.print(TextLine);
+        break;
+
+      case TEXT_SIZE_2:
+        display.setTextSize(2);
+        display.setCursor(4, 16);
+        display.print(&TextLine[11]);
+        break;
+
+      case DRAW_CIRCLE:
+        display.drawCircle(64, 32, 30, WHITE);
+        break;
+
+      case FULL_FLUSH:
+        display.invalidateDisplay();
+        display.display();
+        break;
+
+      case DIRTY_FLUSH:
+        color = !color;
+        display.drawPixel(64, 28, color ? WHITE : BLACK);
+        display.display();
+        break;
+
+      case HASHED_FLUSH:
+        display.display();
+        break;
+      }
+    }
+  return micros() - start;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// fill the screen with text
+/////////////////////////////////////////////////////////////////////////
+void fillScreen()
+  {
+  display.clearDisplay();
+  display.setTextSize(1);
+  for(byte y = 0; y < SCREEN_HEIGHT; y += 8)
+    {
+    display.setCursor(0, y);
+    display.print(TextLine);
+    }
+  display.display();
+  return;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// print drawing operation average time
+/////////////////////////////////////////////////////////////////////////
+void printDrawResult
+    (
+    const __FlashStringHelper* name,
+    unsigned long time
+    )
+  {
+  Serial.print(name);
+  Serial.print(' ');
+  Serial.println(time / BENCHMARK_LOOPS);
+  return;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// print display() flush frame rate, bytes, bus and CPU time per frame
+/////////////////////////////////////////////////////////////////////////
+void printFlushResult
+    (
+    const __FlashStringHelper* name,
+    unsigned long time
+    )
+  {
+  unsigned long frameTime = time / BENCHMARK_LOOPS;
+  unsigned long frameBytes = display.getBytesSent() / BENCHMARK_LOOPS;
+  unsigned long busTime = frameBytes * BUS_NS_PER_BYTE / 1000;
+  Serial.print(name);
+  Serial.print(' ');
+  Serial.print(1000000UL / frameTime);
+  Serial.print(F("  "));
+  Serial.print(frameBytes);
+  Serial.print(F("  "));
+  Serial.print(frameTime);
+  Serial.print(F("  "));
+  Serial.print(busTime);
+  Serial.print(F("  "));
+  Serial.println(frameTime > busTime ? frameTime - busTime : 0);
+  return;
+  }
+
+#endif
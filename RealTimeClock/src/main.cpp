@@ -49,10 +49,11 @@
 #include <Adafruit_SPIDevice.h>
 #include <Adafruit_SSD1306.h>
 #include <OneWire.h>
+#include <OneWireAsync.h>
+#include <OneWireSearch.h>
 #include <DallasTemperature.h>
-
-#define SCREEN_WIDTH 128 // OLED display width, in pixels
-#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+#include "DisplayConfig.h"
+#include "Icons.h"
 
 #define SET_BUTTON 9  // Set button is connected to Arduino pin D9
 #define INC_BUTTON 8  // Inc button is connected to Arduino pin D8
@@ -60,11 +61,35 @@
 #define ALARM_BUZZER 3 // alarm buzzer is connected to D3
 
 #define ONE_WIRE_BUS 2
+#define PROBE_TEMP_ERROR -5500 // getTemp() error in 1/100 celsius
+#define PROBE_CONVERSION_TIME 750 // 12 bit conversion time in milliseconds
+#define PROBE_READ_RETRIES 2 // scratchpad reads repeated after a bad read
+#define PROBE_POWER_ON_RAW 10880 // 85.00 celsius in 1/128 degree, not converted
+
+// set to 1 to print the probe bus health counters to the serial port
+// (USART is taken by the ONEWIRE_UART build)
+#ifndef PROBE_DIAGNOSTICS
+#define PROBE_DIAGNOSTICS 0
+#endif
+#define PROBE_DIAGNOSTICS_PERIOD 60000 // milliseconds
+#if PROBE_DIAGNOSTICS && ONEWIRE_UART
+#error "PROBE_DIAGNOSTICS needs the serial port used by ONEWIRE_UART"
+#endif
+
+#define PROBE_IDLE 0
+#define PROBE_CONVERT 1
+#define PROBE_READ 2
 
 #define EEPROM_SETUP_INDEX 0
 #define EEPROM_ALARM_MINUTE 1
 #define EEPROM_ALARM_HOUR 2
 #define EEPROM_ALARM_LENGTH 3
+#define EEPROM_PROBE_ROM 4 // probe ROM code 8 bytes
+#define EEPROM_PROBE_FLAGS 12 // probe resolution and power mode
+#define EEPROM_PROBE_CRC 13 // CRC8 of probe ROM code and flags
+
+#define PROBE_RESOLUTION_MASK 0x0f
+#define PROBE_PARASITE_MASK 0x80
 
 #define MAIN_MENU_ALARM 0
 #define MAIN_MENU_DATE_TIME 1
@@ -134,11 +159,29 @@
 #define byteToChar1(X) (char) (((X) / 10) + '0')
 #define byteToChar2(X) (char) (((X) % 10) + '0')
 
+// centered text stored in program memory
+// x position is calculated at compile time from the literal length
+struct CenteredText
+  {
+  const char* text;
+  byte x_pos;
+  byte text_size;
+  };
+
+#define CENTERED_TEXT(NAME, TEXT, SIZE) \
+  static_assert(6 * (sizeof(TEXT) - 1) * (SIZE) <= SCREEN_WIDTH, #NAME " is too wide"); \
+  const PROGMEM char NAME##Text[] = {TEXT}; \
+  const PROGMEM CenteredText NAME = {NAME##Text, (SCREEN_WIDTH - 6 * (sizeof(TEXT) - 1) * (SIZE)) / 2, SIZE}
+
 void drawText(byte y_pos, char *text, byte text_size);
 void drawText(byte x_pos, byte y_pos, char *text, byte text_size);
 void drawText(byte x_pos, byte y_pos, const char* text, byte text_size, bool highlight);
-void drawText(byte y_pos, const char* text, byte text_size, bool highlight);
+void drawText(byte y_pos, const CenteredText* text, bool highlight);
 void displayClock();
+void updateProbe();
+void printProbeStats();
+bool readProbeCache();
+void saveProbeCache();
 void setClockModule(bool setDaylight);
 void saveDisplayFormat();
 void saveAlarmParameters();
@@ -157,9 +200,9 @@ byte dayOfTheWeek();
 byte hourToAMPM(char* ampm);
 void getFreeMemory();
  
-// Adafruit_SSD1306 display 128x64 constructor 
-#define OLED_RESET -1
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+// Adafruit_SSD1306 display 128x64 constructor (I2C or SPI see DisplayConfig.h)
+// geometry is fixed at compile time, the display buffer is static
+Adafruit_SSD1306_Fixed<SCREEN_WIDTH, SCREEN_HEIGHT> display(OLED_DISPLAY_ARGS);
 
 // temperature probe class pointers
 OneWire *oneWire = NULL;
@@ -167,6 +210,18 @@ DallasTemperature *probeSensor = NULL;
 DeviceAddress deviceAddress;
 bool probeAddressValid;
 
+// until the probe is found its address is searched in the background
+OneWireSearch probeSearch;
+
+// temperature probe is read in the background by the timer interrupt
+OneWireAsync probeBus;
+byte probeScratchPad[9];
+byte probeState;
+byte probeRetries;
+unsigned long probeTimer;
+unsigned long probeStatsTimer;
+int probeTemp = PROBE_TEMP_ERROR;
+
 byte *paramPtr;
 byte setupIndex;
 
@@ -197,6 +252,9 @@ byte year; // 0 to 99
 
 byte daylight;
 
+byte shiftMinute;
+byte shiftIndex;
+
 byte state;
 byte buttonsState;
 unsigned long setMenuTimer;
@@ -204,6 +262,10 @@ unsigned long setMenuTimeout;
 
 char dispStr[22];
 
+// OLED burn-in protection. vertical image shift in pixels
+// one step every minute. clock screen rows 0 and 63 are kept blank
+int8_t pixelShiftPattern[] = {0, 1, 0, -1};
+
 // last day of the month
 byte lastDayOfMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
@@ -223,47 +285,47 @@ char dayText[7][10] =
 byte paramMax[SETUP_COUNT] = {3, 1, 23, 59, 99, 99, 12, 31, 23, 59, 2, 2, 1, 1};
 
 // save text strings in program memory
-const PROGMEM char SetupStr1[] = {"CLOCK"};
-const PROGMEM char SetupStr2[] = {"Alarm, Calendar,"};
-const PROGMEM char SetupStr3[] = {"Temperature"};
-const PROGMEM char SetupStr4[] = {"Local and Probe"};
-const PROGMEM char UziGranot[] = {" By: Uzi Granot "};
+CENTERED_TEXT(SetupStr1, "CLOCK", 2);
+CENTERED_TEXT(SetupStr2, "Alarm, Calendar,", 1);
+CENTERED_TEXT(SetupStr3, "Temperature", 1);
+CENTERED_TEXT(SetupStr4, "Local and Probe", 1);
+CENTERED_TEXT(UziGranot, " By: Uzi Granot ", 1);
 
-const PROGMEM char selectMenuHeading[] = {"SELECT MENU"};
+CENTERED_TEXT(selectMenuHeading, "SELECT MENU", 1);
 const PROGMEM char selectMenuAlarm[] = {" 1. ALARM CLOCK "};
 const PROGMEM char selectMenuDateTime[] = {" 2. DATE TIME "};
 const PROGMEM char selectMenuDaylight[] = {" 3. DAYLIGHT "};
 const PROGMEM char selectMenuDispStyle[] = {" 4. DISP STYLE "};
 
-const PROGMEM char DaylightMenuHeading[] = {"DAYLIGHT ADJUST"};
+CENTERED_TEXT(DaylightMenuHeading, "DAYLIGHT ADJUST", 1);
 const PROGMEM char DaylightMenuCancel[] = {" CANCEL  "};
 const PROGMEM char DaylightMenuSpring[] = {" SPRING +1 HOUR "};
 const PROGMEM char DaylightMenuFall[] = {" FALL -1 HOUR  "};
 
-const PROGMEM char alarmOnOffMenuHeading[] = {"ALARM CLOCK"};
+CENTERED_TEXT(alarmOnOffMenuHeading, "ALARM CLOCK", 1);
 const PROGMEM char alarmOnOffMenuOff[] = {" 1. ALARM OFF "};
 const PROGMEM char alarmOnOffMenuOn[] = {" 2. ALARM ON "};
 
-const PROGMEM char dateStyleMenuHeading[] = {"DATE STYLE MENU"};
+CENTERED_TEXT(dateStyleMenuHeading, "DATE STYLE MENU", 1);
 const PROGMEM char dateStyleMenuYMD[] = {" 1. YYYY/MM/DD "};
 const PROGMEM char dateStyleMenuDMY[] = {" 2. DD/MM/YYYY "};
 const PROGMEM char dateStyleMenuMDY[] = {" 3. MM/DD/YYYY "};
 
-const PROGMEM char timeStyleMenuHeading[] = {"TIME STYLE MENU"};
+CENTERED_TEXT(timeStyleMenuHeading, "TIME STYLE MENU", 1);
 const PROGMEM char timeStyleMenu24[] = {" 1. 24 HOUR "};
 const PROGMEM char timeStyleMenu12[] = {" 2. 12 HOUR "};
 
-const PROGMEM char tempUnitMenuHeading[] = {"TEMPERATURE UNIT"};
+CENTERED_TEXT(tempUnitMenuHeading, "TEMPERATURE UNIT", 1);
 const PROGMEM char tempUnitMenuC[] = {" 1. CELSIUS "};
 const PROGMEM char tempUnitMenuF[] = {" 2. FAHRENHEIT "};
 
-const PROGMEM char yearStr[] = {"YEAR"};
-const PROGMEM char monthStr[] = {"MONTH"};
-const PROGMEM char dayStr[] = {"DAY"};
-const PROGMEM char hourStr[] = {"HOUR"};
-const PROGMEM char minuteStr[] = {"MINUTE"};
-const PROGMEM char lengthStr[] = {"LENGTH"};
-const PROGMEM char setupStr[] = {"SETUP MENU"};
+CENTERED_TEXT(yearStr, "YEAR", 2);
+CENTERED_TEXT(monthStr, "MONTH", 2);
+CENTERED_TEXT(dayStr, "DAY", 2);
+CENTERED_TEXT(hourStr, "HOUR", 2);
+CENTERED_TEXT(minuteStr, "MINUTE", 2);
+CENTERED_TEXT(lengthStr, "LENGTH", 2);
+CENTERED_TEXT(setupStr, "SETUP MENU", 1);
 const PROGMEM char alarmSetStr[] = {"ALARM AT: "};
 
 /////////////////////////////////////////////////////////////////////////
@@ -275,6 +337,10 @@ void setup()
   // wait a lttle
   delay(200);
 
+#if PROBE_DIAGNOSTICS
+  Serial.begin(115200);
+#endif
+
   // menu mode buttons
   pinMode(SET_BUTTON, INPUT_PULLUP);
   pinMode(INC_BUTTON, INPUT_PULLUP);
@@ -284,6 +350,9 @@ void setup()
   pinMode(ALARM_BUZZER, OUTPUT);
   digitalWrite(ALARM_BUZZER, HIGH);
 
+  // DS3231 clock I2C bus (the SPI display does not start it)
+  Wire.begin();
+
   // display screen SSD1306 initialization
  	display.begin(SSD1306_SWITCHCAPVCC, 0x3C);
   display.setTextColor(WHITE,BLACK);
@@ -292,11 +361,11 @@ void setup()
   display.clearDisplay();
 
   // display initialization message
-  drawText(0, SetupStr1, 2, false);
-  drawText(18, SetupStr2, 1, false);
-  drawText(30, SetupStr3, 1, false);
-  drawText(42, SetupStr4, 1, false);
-  drawText(54, UziGranot, 1, true);
+  drawText(0, &SetupStr1, false);
+  drawText(18, &SetupStr2, false);
+  drawText(30, &SetupStr3, false);
+  drawText(42, &SetupStr4, false);
+  drawText(54, &UziGranot, true);
 
   display.display();
 
@@ -335,11 +404,13 @@ void setup()
 	// set temperature sensor
 	probeSensor = new DallasTemperature();
 	probeSensor->setOneWire(oneWire);
-	probeSensor->begin();
 
-  // temperature probe address
-  probeAddressValid = false;
-  if(probeSensor->getAddress(deviceAddress, 0)) probeAddressValid = true;
+  // temperature probe address saved by a previous run
+  // otherwise it is found by updateProbe()
+  probeAddressValid = readProbeCache();
+  probeSearch.begin(*oneWire);
+  probeBus.begin(ONE_WIRE_BUS);
+  probeState = PROBE_IDLE;
 
   // set clock display state
   state = STATE_CLOCK;
@@ -585,6 +656,14 @@ void displayClock()
   month = readRS3231();
   year = readRS3231();
 
+  // move the clock screen image by one pixel every minute
+  if(minute != shiftMinute)
+    {
+    shiftMinute = minute;
+    shiftIndex = (shiftIndex + 1) & 3;
+    display.pixelShift(pixelShiftPattern[shiftIndex]);
+    }
+
   // daylight saving time adjustment
   if(daylight != DAYLIGHT_CANCEL)
     {
@@ -611,16 +690,12 @@ void displayClock()
   // clock module temperature in 1/100 celsius
   int clockTemp = 25 * (((temp_msb << 8) | temp_lsb) >> 6);
 
-  // call sensors.requestTemperatures() to issue a global temperature
-  // request to all devices on the bus (we have only one)
-  probeSensor->requestTemperatures();
-
-  // get probe temperatore
-  int probeTemp = probeSensor->getTemp((uint8_t*) deviceAddress);
-
-  // convert to degree celcius
-  // if error result will be PROBE_TEMP_ERROR -5500
-  probeTemp = (int) ((25 * (long) probeTemp) >> 5);
+  // advance the background probe reading
+  // probeTemp is PROBE_TEMP_ERROR -5500 until the first good reading
+  updateProbe();
+#if PROBE_DIAGNOSTICS
+  printProbeStats();
+#endif
 
   // clear display
   display.clearDisplay();
@@ -678,7 +753,7 @@ void displayClock()
 
   // Display the date year month day
   dispStr[strlen++] = 0;
-  drawText(0, dispStr, 1);
+  drawText(1, dispStr, 1);
 
   // Display the time
   char ampm;
@@ -740,8 +815,13 @@ void displayClock()
       }
     dispStr[strlen] = 0;
     drawText(33, dispStr, 1);
+    display.drawPageBitmap(0, 32, iconBell, ICON_SMALL_WIDTH, ICON_SMALL_HEIGHT, WHITE, BLACK);
     }
 
+  // daylight saving adjustment is waiting for a safe time
+  if(daylight != DAYLIGHT_CANCEL)
+    display.drawPageBitmap(120, 32, iconDaylight, ICON_SMALL_WIDTH, ICON_SMALL_HEIGHT, WHITE, BLACK);
+
   // convert clock module temperature to string
   tempToStr(clockTemp);
 
@@ -753,12 +833,18 @@ void displayClock()
   tempToStr(probeTemp);
 
   // Display the temperature
-  drawText(0, 57, (char*)"Probe", 1);
-  drawText(57, dispStr, 1);
+  // or the probe missing marker if there is no reading
+  drawText(0, 56, (char*)"Probe", 1);
+  if(probeAddressValid && probeTemp != PROBE_TEMP_ERROR)
+    drawText(56, dispStr, 1);
+  else
+    display.drawPageBitmap((SCREEN_WIDTH - ICON_SMALL_WIDTH) / 2, 56, iconProbeMissing,
+      ICON_SMALL_WIDTH, ICON_SMALL_HEIGHT, WHITE, BLACK);
 
-  // display temperature units
-  display.drawCircle(110, 51, 3, WHITE);     // Put degree symbol ( ° )
-  drawText(116, 48, tempUnit == TEMP_FORMAT_C ? (char*)"C" : (char*)"F", 2);
+  // display temperature units, degree symbol ( ° ) and C or F
+  display.drawPageBitmap(ICON_DEGREE_X, ICON_DEGREE_Y,
+    tempUnit == TEMP_FORMAT_C ? iconDegreeC : iconDegreeF,
+    ICON_DEGREE_WIDTH, ICON_DEGREE_HEIGHT, WHITE, BLACK);
 
   // display normal clock screen  
   display.display();
@@ -797,6 +883,151 @@ void displayClock()
   return;
   }
 
+/////////////////////////////////////////////////////////////////////////
+// temperature probe background reading
+// conversion and scratchpad read run as OneWireAsync transactions
+// so the clock screen keeps updating while the bus is working
+/////////////////////////////////////////////////////////////////////////
+void updateProbe()
+  {
+  // bus transaction is still running
+  if(probeBus.busy()) return;
+
+  switch(probeState)
+    {
+    // start temperature conversion
+    case PROBE_IDLE:
+      // look for the probe a few address bits at a time
+      // the first temperature sensor on the bus is used
+      if(!probeAddressValid)
+        {
+        probeTemp = PROBE_TEMP_ERROR;
+        if(probeSearch.step() == ONEWIRE_SEARCH_FOUND &&
+          probeSensor->addDevice(probeSearch.address()))
+          {
+          memcpy(deviceAddress, probeSearch.address(), sizeof(DeviceAddress));
+          probeAddressValid = true;
+          saveProbeCache();
+          }
+        return;
+        }
+      probeBus.reset();
+      probeBus.select(deviceAddress);
+      probeBus.write(0x44, probeSensor->isParasitePowerMode());  // start conversion
+      probeBus.start();
+      probeTimer = millis();
+      probeRetries = 0;
+      probeState = PROBE_CONVERT;
+      return;
+
+    // wait for conversion time then read scratchpad
+    case PROBE_CONVERT:
+      if(probeBus.status() != ONEWIRE_ASYNC_DONE)
+        {
+        probeTemp = PROBE_TEMP_ERROR;
+        probeState = PROBE_IDLE;
+        return;
+        }
+      if(millis() - probeTimer < PROBE_CONVERSION_TIME) return;
+      probeBus.reset();
+      probeBus.select(deviceAddress);
+      probeBus.write(0xBE);  // read scratchpad
+      probeBus.read_bytes(probeScratchPad, 9);
+      probeBus.start();
+      probeState = PROBE_READ;
+      return;
+
+    // convert scratchpad to 1/100 degree celcius
+    // configuration byte 4 is never zero, all zeros is a bus error
+    // failures are counted in the bus and sensor health counters
+    case PROBE_READ:
+      if(probeBus.status() == ONEWIRE_ASYNC_DONE)
+        {
+        if(probeScratchPad[4] == 0) probeBus.stats.count_read(ONEWIRE_READ_ZEROS);
+        else if(OneWire::crc8(probeScratchPad, 8) != probeScratchPad[8]) probeBus.stats.count_read(ONEWIRE_READ_CRC);
+        else
+          {
+          int raw = DallasTemperature::calculateTemperature(deviceAddress, probeScratchPad);
+          if(raw != PROBE_POWER_ON_RAW)
+            {
+            probeTemp = (int) ((25 * (long) raw) >> 5);
+            probeState = PROBE_IDLE;
+            return;
+            }
+
+          // power on value, the probe lost power and did not convert
+          probeSensor->stats.conversionTimeouts++;
+          probeRetries = PROBE_READ_RETRIES;
+          }
+
+        // the conversion result is still in the scratchpad
+        // PROBE_CONVERT reads it again right away
+        if(probeRetries < PROBE_READ_RETRIES)
+          {
+          probeRetries++;
+          probeSensor->stats.readRetries++;
+          probeState = PROBE_CONVERT;
+          return;
+          }
+        }
+      probeSensor->stats.readErrors++;
+      probeTemp = PROBE_TEMP_ERROR;
+      probeState = PROBE_IDLE;
+      return;
+    }
+  return;
+  }
+
+#if PROBE_DIAGNOSTICS
+/////////////////////////////////////////////////////////////////////////
+// print probe bus health counters once a minute
+// sensor: retries, failed readings, conversions not done
+// 1-wire: setup and search traffic, async: background readings
+/////////////////////////////////////////////////////////////////////////
+void printProbeStats()
+  {
+  if(millis() - probeStatsTimer < PROBE_DIAGNOSTICS_PERIOD) return;
+  probeStatsTimer += PROBE_DIAGNOSTICS_PERIOD;
+  probeSensor->printStats(Serial);
+  Serial.print(F("async "));
+  probeBus.stats.print(Serial);
+  return;
+  }
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+// read probe address, resolution and power mode saved in eeprom
+// the probe is used without a bus search if it still answers
+/////////////////////////////////////////////////////////////////////////
+bool readProbeCache()
+  {
+  byte cache[EEPROM_PROBE_CRC - EEPROM_PROBE_ROM];
+  for(byte index = 0; index < sizeof(cache); index++) cache[index] = EEPROM.read(EEPROM_PROBE_ROM + index);
+  if(OneWire::crc8(cache, sizeof(cache)) != EEPROM.read(EEPROM_PROBE_CRC)) return false;
+
+  // one match ROM and scratchpad read
+  byte flags = cache[EEPROM_PROBE_FLAGS - EEPROM_PROBE_ROM];
+  if(!probeSensor->addCachedDevice(cache, flags & PROBE_RESOLUTION_MASK, (flags & PROBE_PARASITE_MASK) != 0)) return false;
+  memcpy(deviceAddress, cache, sizeof(DeviceAddress));
+  return true;
+  }
+
+/////////////////////////////////////////////////////////////////////////
+// save probe address, resolution and power mode after a bus search
+/////////////////////////////////////////////////////////////////////////
+void saveProbeCache()
+  {
+  byte cache[EEPROM_PROBE_CRC - EEPROM_PROBE_ROM];
+  memcpy(cache, deviceAddress, sizeof(DeviceAddress));
+  cache[EEPROM_PROBE_FLAGS - EEPROM_PROBE_ROM] = probeSensor->getResolution() |
+    (probeSensor->isParasitePowerMode() ? PROBE_PARASITE_MASK : 0);
+
+  // only bytes that changed are written
+  for(byte index = 0; index < sizeof(cache); index++) EEPROM.update(EEPROM_PROBE_ROM + index, cache[index]);
+  EEPROM.update(EEPROM_PROBE_CRC, OneWire::crc8(cache, sizeof(cache)));
+  return;
+  }
+
 /////////////////////////////////////////////////////////////////////////
 // set clock module parameters after user setup
 /////////////////////////////////////////////////////////////////////////
@@ -944,83 +1175,86 @@ void saveAlarmParameters()
 /////////////////////////////////////////////////////////////////////////
 void displaySetupMenu()
   {
+  // menu screens are not shifted
+  display.pixelShift(0);
+
   // clear display
   display.clearDisplay();
 
   // parameter name
-  const char* name;
+  const CenteredText* name;
 
   // switch based on parameter
   switch(setupIndex)
     {
     case SETUP_SUB_MENU:
-      drawText(0, selectMenuHeading, 1, false);
+      drawText(0, &selectMenuHeading, false);
       submenu = MAIN_MENU_ALARM;
       drawMainMenuParam();
       paramPtr = &submenu;
       return;
       
     case SETUP_ALARM_SET:
-      drawText(0, alarmOnOffMenuHeading, 1, false);
+      drawText(0, &alarmOnOffMenuHeading, false);
       drawAlarmOnOffMenu();
       paramPtr = &alarmSet;
       return;
 
     case SETUP_DAYLIGHT_START:
-      drawText(0, DaylightMenuHeading, 1, false);
+      drawText(0, &DaylightMenuHeading, false);
       drawDaylightMenu();
       paramPtr = &daylight;
       return;
       
     case SETUP_DATE_STYLE:
       if(dateStyle > 2) dateStyle = 0;
-      drawText(0, dateStyleMenuHeading, 1, false);
+      drawText(0, &dateStyleMenuHeading, false);
       drawDateStyleMenu();
       paramPtr = &dateStyle;
       return;
       
     case SETUP_TIME_STYLE:
       if(timeStyle > 1) timeStyle = 0;
-      drawText(0, timeStyleMenuHeading, 1, false);
+      drawText(0, &timeStyleMenuHeading, false);
       drawTimeStyleMenu();
       paramPtr = &timeStyle;
       return;
       
     case SETUP_TEMP_UNIT:
       if(tempUnit > 1) tempUnit = 0;
-      drawText(0, tempUnitMenuHeading, 1, false);
+      drawText(0, &tempUnitMenuHeading, false);
       drawTempUnitMenu();
       paramPtr = &tempUnit;
       return;
 
     case SETUP_ALARM_HOUR:
-      name = hourStr;
+      name = &hourStr;
       paramPtr = &alarmHour;
       break;
       
     case SETUP_ALARM_MINUTE:
-      name = minuteStr;
+      name = &minuteStr;
       paramPtr = &alarmMinute;
       break;
       
     case SETUP_ALARM_LENGTH:
-      name = lengthStr;
+      name = &lengthStr;
       paramPtr = &alarmLength;
       break;
       
     case SETUP_YEAR:
-      name = yearStr;
+      name = &yearStr;
       paramPtr = &year;
       break;
       
     case SETUP_MONTH:
-      name = monthStr;
+      name = &monthStr;
       if(month == 0) month++;
       paramPtr = &month;
       break;
       
     case SETUP_DAY:
-      name = dayStr;
+      name = &dayStr;
       if(day == 0) day++;
       paramMax[SETUP_DAY] = lastDayOfMonth[month - 1];
       if(month == 2 && (year % 4) == 0) paramMax[SETUP_DAY]++;
@@ -1028,12 +1262,12 @@ void displaySetupMenu()
       break;
       
     case SETUP_HOUR:
-      name = hourStr;
+      name = &hourStr;
       paramPtr = &hour;
       break;
       
     case SETUP_MINUTE:
-      name = minuteStr;
+      name = &minuteStr;
       paramPtr = &minute;
       break;
 
@@ -1042,8 +1276,8 @@ void displaySetupMenu()
   // make sure parameter is within limits
   if(paramPtr[0] > paramMax[setupIndex]) paramPtr[0] = paramMax[setupIndex];
 
-  drawText(0, setupStr, 1, false);
-  drawText(22, name, 2, false);
+  drawText(0, &setupStr, false);
+  drawText(22, name, false);
   displaySetupMenuParameters();
   return;
   }
@@ -1286,9 +1520,8 @@ void writeRS3231
 /////////////////////////////////////////////////////////////////////////
 void drawText(byte x_pos, byte y_pos, char *text, byte text_size)
   {
-  display.setCursor(x_pos, y_pos);
-  display.setTextSize(text_size);
-  display.print(text);
+  display.drawString(x_pos, y_pos, text, 0xFFFF, text_size,
+    display.getTextColor(), display.getTextBgColor());
   return;
   }
 
@@ -1308,22 +1541,24 @@ void drawText(byte y_pos, char *text, byte text_size)
 /////////////////////////////////////////////////////////////////////////
 void drawText(byte x_pos, byte y_pos, const char* text, byte text_size, bool highlight)
   {
-  strcpy_P(dispStr, (PGM_P) text);
   if(highlight) display.setTextColor(BLACK,WHITE);
-  drawText(x_pos, y_pos, (char*) dispStr, text_size);
+  display.setTextSize(text_size);
+  display.drawStringP(x_pos, y_pos, text);
   if(highlight) display.setTextColor(WHITE,BLACK);
   return;
   }
 
 /////////////////////////////////////////////////////////////////////////
-// draw text stored in PROGMEM to the screen
-// text will be centered
+// draw centered text stored in PROGMEM to the screen
+// position and size come from the descriptor, text is drawn from flash
 /////////////////////////////////////////////////////////////////////////
-void drawText(byte y_pos, const char* text, byte text_size, bool highlight)
+void drawText(byte y_pos, const CenteredText* text, bool highlight)
   {
-  strcpy_P(dispStr, (PGM_P) text);
+  CenteredText desc;
+  memcpy_P(&desc, text, sizeof(CenteredText));
   if(highlight) display.setTextColor(BLACK,WHITE);
-  drawText(y_pos, (char*) dispStr, text_size);
+  display.setTextSize(desc.text_size);
+  display.drawStringP(desc.x_pos, y_pos, desc.text);
   if(highlight) display.setTextColor(WHITE,BLACK);
   return;
   }
@@ -0,0 +1,97 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Just enough of the Arduino API to build the OneWire and
+// DallasTemperature libraries on the host, for [env:native].
+//
+// There is no hardware: the 1-Wire pin is the simulated bus of
+// OneWireVirtual.h, and time is the bus clock of that model.  delay()
+// and delayMicroseconds() advance it, millis() and micros() read it,
+// so conversion waits and timeouts take no real time and every run
+// gives the same timing.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// from OneWireVirtual.h, which needs this header itself
+unsigned long onewire_virtual_micros(void);
+void onewire_virtual_delay(unsigned int us);
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define DEC 10
+#define HEX 16
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// The only pin is the bus, handled by util/OneWire_direct_gpio.h
+inline void pinMode(uint8_t, uint8_t) { }
+inline void digitalWrite(uint8_t, uint8_t) { }
+inline int digitalRead(uint8_t) { return HIGH; }
+
+inline void delayMicroseconds(unsigned int us) { onewire_virtual_delay(us); }
+inline void delay(unsigned long ms)
+{
+	while (ms--) onewire_virtual_delay(1000);
+}
+inline unsigned long micros(void) { return onewire_virtual_micros(); }
+inline unsigned long millis(void) { return onewire_virtual_micros() / 1000; }
+inline void yield(void) { }
+
+inline void noInterrupts(void) { }
+inline void interrupts(void) { }
+
+// Text output for the statistics dumps; a test collects it by
+// implementing write()
+class Print
+{
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+
+    size_t print(const char *s)
+    {
+      size_t n = 0;
+      while (*s) n += write((uint8_t)*s++);
+      return n;
+    }
+    size_t print(const __FlashStringHelper *s) { return print(reinterpret_cast<const char *>(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned long v, int base = DEC)
+    {
+      char buf[8 * sizeof(long) + 1];
+      char *p = &buf[sizeof(buf) - 1];
+      *p = 0;
+      do {
+        uint8_t d = v % base;
+        *--p = d < 10 ? '0' + d : 'A' + d - 10;
+        v /= base;
+      } while (v);
+      return print(p);
+    }
+    size_t print(long v, int base = DEC)
+    {
+      if (v < 0 && base == DEC) return print('-') + print((unsigned long)-v, base);
+      return print((unsigned long)v, base);
+    }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+
+    size_t println(void) { return print("\r\n"); }
+    template <typename T> size_t println(T v) { return print(v) + println(); }
+};
+
+#endif // Arduino_h
@@ -0,0 +1,297 @@
+// OneWire, OneWireSearch, OneWireAsync and DallasTemperature on the
+// simulated bus of OneWireVirtual.h, run on the host:
+//
+//    pio test -e native
+//
+// Each test starts with three devices on the bus: a DS18B20 and a
+// DS18S20 on external power, and a parasite powered DS1822.  Bus time is
+// the model's clock, so the timing figures are exact and repeatable.
+
+#include <Arduino.h>
+#include <OneWire.h>
+#include <OneWireAsync.h>
+#include <OneWireSearch.h>
+#include <OneWireVirtual.h>
+#include <DallasTemperature.h>
+#include <stdio.h>
+#include <unity.h>
+
+#define DEVICES 3
+
+static OneWire bus(2);
+static DallasTemperature *sensors;
+static OneWireVirtualDevice *probe, *outside, *parasite;
+static OneWireVirtualDevice *all[DEVICES];
+
+// Print into a string, for the statistics dumps
+class StringPrint : public Print
+{
+  public:
+    char text[128];
+    size_t length;
+
+    StringPrint() : length(0) { text[0] = 0; }
+    size_t write(uint8_t c)
+    {
+      if (length + 1 >= sizeof(text)) return 0;
+      text[length++] = c;
+      text[length] = 0;
+      return 1;
+    }
+};
+
+// Index in all[] of the device with this ROM code, -1 if none
+static int find_device(const uint8_t *addr)
+{
+	for (int i = 0; i < DEVICES; i++)
+		if (memcmp(all[i]->address(), addr, 8) == 0) return i;
+	return -1;
+}
+
+void setUp(void)
+{
+	probe = new OneWireVirtualDevice(DS18B20MODEL, 0x123456);
+	outside = new OneWireVirtualDevice(DS18S20MODEL, 0x123457);
+	parasite = new OneWireVirtualDevice(DS1822MODEL, 0x999, true);
+	all[0] = probe;
+	all[1] = outside;
+	all[2] = parasite;
+	probe->set_temperature(21.5);
+	outside->set_temperature(-3.25);
+	parasite->set_temperature(-10.0625);
+	for (int i = 0; i < DEVICES; i++)
+		onewire_virtual_attach(all[i]);
+
+	bus.reset_search();
+	bus.stats.clear();
+	sensors = new DallasTemperature(&bus);
+}
+
+void tearDown(void)
+{
+	delete sensors;
+	for (int i = 0; i < DEVICES; i++) {
+		onewire_virtual_detach(all[i]);
+		delete all[i];
+	}
+	onewire_virtual_bit_error(0);
+}
+
+// OneWire::search() walks the ROM tree through the collisions
+void test_search_finds_every_device(void)
+{
+	uint8_t addr[8];
+	bool seen[DEVICES] = {false, false, false};
+	int found = 0;
+
+	while (bus.search(addr)) {
+		TEST_ASSERT_EQUAL_HEX8(OneWire::crc8(addr, 7), addr[7]);
+		int i = find_device(addr);
+		TEST_ASSERT_TRUE(i >= 0);
+		TEST_ASSERT_FALSE(seen[i]);
+		seen[i] = true;
+		found++;
+	}
+	TEST_ASSERT_EQUAL(DEVICES, found);
+}
+
+// OneWireSearch finds the same devices a few bits at a time, with other
+// bus traffic in between, and starts over after ONEWIRE_SEARCH_DONE
+void test_incremental_search(void)
+{
+	OneWireSearch finder(bus);
+
+	for (int pass = 0; pass < 2; pass++) {
+		bool seen[DEVICES] = {false, false, false};
+		int found = 0;
+		uint8_t r;
+
+		while ((r = finder.step(3)) != ONEWIRE_SEARCH_DONE) {
+			if (r == ONEWIRE_SEARCH_FOUND) {
+				int i = find_device(finder.address());
+				TEST_ASSERT_TRUE(i >= 0);
+				TEST_ASSERT_FALSE(seen[i]);
+				seen[i] = true;
+				found++;
+				// something else uses the bus
+				TEST_ASSERT_TRUE(sensors->isConnected(probe->address()));
+				finder.restart_pass();
+			}
+		}
+		TEST_ASSERT_EQUAL(DEVICES, found);
+	}
+}
+
+void test_temperatures(void)
+{
+	sensors->begin();
+	TEST_ASSERT_EQUAL(DEVICES, sensors->getDeviceCount());
+	TEST_ASSERT_EQUAL(DEVICES, sensors->getDS18Count());
+	TEST_ASSERT_TRUE(sensors->isParasitePowerMode());
+	TEST_ASSERT_EQUAL(12, sensors->getResolution());
+
+	sensors->requestTemperatures();
+	TEST_ASSERT_EQUAL_FLOAT(21.5, sensors->getTempC(probe->address()));
+	TEST_ASSERT_EQUAL_FLOAT(-3.25, sensors->getTempC(outside->address()));
+	TEST_ASSERT_EQUAL_FLOAT(-10.0625, sensors->getTempC(parasite->address()));
+	TEST_ASSERT_EQUAL(0, sensors->stats.readErrors);
+	TEST_ASSERT_EQUAL(0, sensors->stats.conversionTimeouts);
+}
+
+// At 9 bits the three low bits of the reading are 0
+void test_resolution(void)
+{
+	sensors->begin();
+	TEST_ASSERT_TRUE(sensors->setResolution(probe->address(), 9));
+	TEST_ASSERT_EQUAL(9, sensors->getResolution(probe->address()));
+
+	probe->set_temperature(21.4375);
+	TEST_ASSERT_TRUE(sensors->requestTemperaturesByAddress(probe->address()));
+	TEST_ASSERT_EQUAL_FLOAT(21.0, sensors->getTempC(probe->address()));
+}
+
+// Without the strong pullup a parasite powered device browns out during
+// the conversion and reads the power on value
+void test_parasite_needs_strong_pullup(void)
+{
+	bus.reset();
+	bus.select(parasite->address());
+	bus.write(0x44, 0);
+	delay(800);
+	TEST_ASSERT_EQUAL_FLOAT(85.0, sensors->getTempC(parasite->address()));
+}
+
+// A bit flipped in a scratchpad read is caught by the CRC and the read
+// is repeated
+void test_bit_error_is_retried(void)
+{
+	sensors->begin();
+	sensors->requestTemperatures();
+	sensors->clearStats();
+	bus.stats.clear();
+
+	// reset, Match ROM and Read Scratchpad are 81 slots; spoil bit 20
+	// of the scratchpad
+	onewire_virtual_bit_error(1 + 8 * 10 + 20);
+	TEST_ASSERT_EQUAL_FLOAT(21.5, sensors->getTempC(probe->address()));
+	TEST_ASSERT_EQUAL(1, sensors->stats.readRetries);
+	TEST_ASSERT_EQUAL(0, sensors->stats.readErrors);
+	TEST_ASSERT_EQUAL(1, bus.stats.crcErrors);
+}
+
+// An unplugged probe reads all 1s, which fails the header check before
+// the whole scratchpad is read
+void test_detached_device(void)
+{
+	sensors->begin();
+	sensors->requestTemperatures();
+	sensors->clearStats();
+	bus.stats.clear();
+
+	onewire_virtual_detach(probe);
+	TEST_ASSERT_EQUAL_FLOAT(DEVICE_DISCONNECTED_C, sensors->getTempC(probe->address()));
+	TEST_ASSERT_EQUAL(1, sensors->stats.readErrors);
+	TEST_ASSERT_TRUE(bus.stats.headerErrors > 0);
+	TEST_ASSERT_EQUAL(0, bus.stats.crcErrors);
+	TEST_ASSERT_TRUE(sensors->isConnected(outside->address()));
+
+	StringPrint out;
+	sensors->printStats(out);
+	TEST_ASSERT_NOT_NULL(strstr(out.text, "errors 1"));
+}
+
+// Alarm Search only finds devices whose last reading is outside TL-TH
+void test_alarm_search(void)
+{
+	uint8_t addr[8];
+	bool seen[DEVICES] = {false, false, false};
+
+	sensors->begin();
+	for (int i = 0; i < DEVICES; i++) {
+		sensors->setHighAlarmTemp(all[i]->address(), 30);
+		sensors->setLowAlarmTemp(all[i]->address(), 0);
+	}
+	sensors->requestTemperatures();
+
+	sensors->resetAlarmSearch();
+	while (sensors->alarmSearch(addr)) {
+		int i = find_device(addr);
+		TEST_ASSERT_TRUE(i >= 0);
+		seen[i] = true;
+	}
+	TEST_ASSERT_FALSE(seen[0]);
+	TEST_ASSERT_TRUE(seen[1]);
+	TEST_ASSERT_TRUE(seen[2]);
+}
+
+// Off AVR start() runs the whole transaction before it returns
+void test_async_scratchpad_read(void)
+{
+	OneWireAsync async(2);
+	uint8_t pad[9], expected[9];
+
+	probe->scratchpad(expected);
+	async.reset();
+	async.select(probe->address());
+	async.write(0xBE);
+	async.read_bytes(pad, 9);
+	TEST_ASSERT_TRUE(async.start());
+	TEST_ASSERT_EQUAL(ONEWIRE_ASYNC_DONE, async.status());
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, pad, 9);
+}
+
+// Bus time of the common operations.  The bounds catch gross timing
+// changes; the figures are printed for comparison between versions.
+void test_bus_timing(void)
+{
+	char msg[80];
+	unsigned long t;
+
+	t = micros();
+	sensors->begin();
+	unsigned long begin_us = micros() - t;
+
+	t = micros();
+	sensors->requestTemperatures();
+	unsigned long convert_us = micros() - t;
+
+	t = micros();
+	sensors->getTempC(probe->address());
+	unsigned long read_us = micros() - t;
+
+	uint32_t slots = onewire_virtual_slots();
+	OneWireSearch finder(bus);
+	while (finder.step() != ONEWIRE_SEARCH_DONE) { }
+	slots = onewire_virtual_slots() - slots;
+
+	snprintf(msg, sizeof(msg), "begin %luus, convert %luus, read %luus, search %u slots",
+		begin_us, convert_us, read_us, (unsigned)slots);
+	TEST_MESSAGE(msg);
+
+	// 12 bit conversion: 750mS, done when the parasite device is
+	TEST_ASSERT_TRUE(convert_us >= 750000UL && convert_us < 800000UL);
+	// a reset of about 960uS, then Match ROM, Read Scratchpad and 9
+	// bytes: 153 slots of about 70uS
+	TEST_ASSERT_TRUE(read_us < 13000UL);
+	// 3 passes of reset, command and 64 bits of 3 slots each; the last
+	// device says there are no more, no further reset is needed
+	TEST_ASSERT_EQUAL(3 * (1 + 8 + 64 * 3), slots);
+}
+
+int main(int argc, char **argv)
+{
+	(void)argc;
+	(void)argv;
+	UNITY_BEGIN();
+	RUN_TEST(test_search_finds_every_device);
+	RUN_TEST(test_incremental_search);
+	RUN_TEST(test_temperatures);
+	RUN_TEST(test_resolution);
+	RUN_TEST(test_parasite_needs_strong_pullup);
+	RUN_TEST(test_bit_error_is_retried);
+	RUN_TEST(test_detached_device);
+	RUN_TEST(test_alarm_search);
+	RUN_TEST(test_async_scratchpad_read);
+	RUN_TEST(test_bus_timing);
+	return UNITY_END();
+}